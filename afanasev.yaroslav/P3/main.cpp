@@ -5,76 +5,88 @@
 
 namespace afanasev
 {
-  long long doCntLocMin(const long long * mtx, size_t r, size_t c)
+  const size_t ring_rows = 3;
+
+  size_t doCntRowLocMin(const long long * up, const long long * mid, const long long * down, size_t c)
   {
-    if (!mtx || r < 3 || c < 3)
-    {
-      return 0;
-    }
     bool flag = 1;
     long long n = 0;
     size_t ans = 0;
 
-    for (size_t y = 1; y < r - 1; y++)
+    for (size_t x = 1; x < c - 1; x++)
     {
-      flag = 1;
-      for (size_t x = 1; x < c - 1; x++)
-      {
-        n = mtx[(y * c) + (x)];
-        flag = flag && (n < mtx[(y - 1) * c + (x - 1)]);
-        flag = flag && (n < mtx[(y - 1) * c + (x)]);
-        flag = flag && (n < mtx[(y - 1) * c + (x + 1)]);
+      n = mid[x];
+      flag = flag && (n < up[x - 1]);
+      flag = flag && (n < up[x]);
+      flag = flag && (n < up[x + 1]);
 
-        flag = flag && (n < mtx[(y * c) + (x - 1)]);
-        flag = flag && (n < mtx[(y * c) + (x + 1)]);
+      flag = flag && (n < mid[x - 1]);
+      flag = flag && (n < mid[x + 1]);
 
-        flag = flag && (n < mtx[(y + 1) * c + (x - 1)]);
-        flag = flag && (n < mtx[(y + 1) * c + (x)]);
-        flag = flag && (n < mtx[(y + 1) * c + (x + 1)]);
+      flag = flag && (n < down[x - 1]);
+      flag = flag && (n < down[x]);
+      flag = flag && (n < down[x + 1]);
 
-        if (flag)
-        {
-          ans++;
-        }
+      if (flag)
+      {
+        ans++;
       }
     }
     return ans;
   }
 
-  long long doCntLocMax(const long long * mtx, size_t r, size_t c)
+  size_t doCntRowLocMax(const long long * up, const long long * mid, const long long * down, size_t c)
   {
-    if (!mtx || r < 3 || c < 3)
-    {
-      return 0;
-    }
     bool flag = 1;
     long long n = 0;
     size_t ans = 0;
 
-    for (size_t y = 1; y < r - 1; y++)
+    for (size_t x = 1; x < c - 1; x++)
     {
-      flag = 1;
-      for (size_t x = 1; x < c - 1; x++)
-      {
-        n = mtx[(y * c) + (x)];
-        flag = flag && (n > mtx[(y - 1) * c + (x - 1)]);
-        flag = flag && (n > mtx[(y - 1) * c + (x)]);
-        flag = flag && (n > mtx[(y - 1) * c + (x + 1)]);
+      n = mid[x];
+      flag = flag && (n > up[x - 1]);
+      flag = flag && (n > up[x]);
+      flag = flag && (n > up[x + 1]);
 
-        flag = flag && (n > mtx[(y * c) + (x - 1)]);
-        flag = flag && (n > mtx[(y * c) + (x + 1)]);
+      flag = flag && (n > mid[x - 1]);
+      flag = flag && (n > mid[x + 1]);
 
-        flag = flag && (n > mtx[(y + 1) * c + (x - 1)]);
-        flag = flag && (n > mtx[(y + 1) * c + (x)]);
-        flag = flag && (n > mtx[(y + 1) * c + (x + 1)]);
+      flag = flag && (n > down[x - 1]);
+      flag = flag && (n > down[x]);
+      flag = flag && (n > down[x + 1]);
 
-        if (flag)
+      if (flag)
+      {
+        ans++;
+      }
+    }
+    return ans;
+  }
+
+  std::istream & doCntLocExt(std::istream & input, long long * ring, size_t r, size_t c, long long & min, long long & max)
+  {
+    min = 0;
+    max = 0;
+    for (size_t y = 0; y < r; y++)
+    {
+      long long * down = ring + (y % ring_rows) * c;
+      for (size_t x = 0; x < c; x++)
+      {
+        if (!(input >> down[x]))
         {
-          ans++;
+          return input;
         }
       }
+      if (y < 2 || c < 3)
+      {
+        continue;
+      }
+      const long long * up = ring + ((y - 2) % ring_rows) * c;
+      const long long * mid = ring + ((y - 1) % ring_rows) * c;
+      min += doCntRowLocMin(up, mid, down, c);
+      max += doCntRowLocMax(up, mid, down, c);
     }
-    return ans;
+    return input;
   }
 }
 
@@ -107,6 +119,7 @@ int main(int argc, char ** argv)
   }
 
   size_t r = r1, c = c1;
+  size_t ring = r < afanasev::ring_rows ? r : afanasev::ring_rows;
   long long * mtx = nullptr;
 
   const size_t size_mtx = 10000;
@@ -114,7 +127,7 @@ int main(int argc, char ** argv)
 
   if (!std::strcmp(argv[1], "2"))
   {
-    mtx = reinterpret_cast< long long * >(malloc(r * c * sizeof(long long)));
+    mtx = reinterpret_cast< long long * >(malloc(ring * c * sizeof(long long)));
 
     if (mtx == nullptr)
     {
@@ -127,27 +140,17 @@ int main(int argc, char ** argv)
     mtx = fix_mtx;
   }
 
-  for (size_t i = 0; i < (r * c); i++)
-  {
-    input >> mtx[i];
-    if (input.fail())
-    {
-      std::cerr << "Incorrect input" << '\n';
-      if (!std::strcmp(argv[1], "2"))
-      {
-        free(mtx);
-      }
-      return 2;
-    }
-  }
-
-  long long min = afanasev::doCntLocMin(mtx, r, c);
-  long long max = afanasev::doCntLocMax(mtx, r, c);
-
+  long long min = 0, max = 0;
+  afanasev::doCntLocExt(input, mtx, r, c, min, max);
   if (!std::strcmp(argv[1], "2"))
   {
     free(mtx);
   }
+  if (input.fail())
+  {
+    std::cerr << "Incorrect input" << '\n';
+    return 2;
+  }
 
   std::ofstream output(argv[3]);
   if (!output) {
@@ -61,18 +61,27 @@ namespace afanasev
     return str;
   }
 
+  const size_t charset_size = 256;
+
   void deletingLetters(const char * str, const char * let, char * out)
   {
+    bool keep[charset_size];
+    for (size_t c = 0; c < charset_size; ++c)
+    {
+      keep[c] = true;
+    }
+    for (size_t i = 0; let[i] != '\0'; ++i)
+    {
+      keep[static_cast< unsigned char >(let[i])] = false;
+    }
+
     size_t i = 0;
     size_t out1_l = 0;
 
     while (str[i] != '\0')
     {
-      if (!std::strchr(let, str[i]))
-      {
-        out[out1_l] = str[i];
-        out1_l++;
-      }
+      out[out1_l] = str[i];
+      out1_l += keep[static_cast< unsigned char >(str[i])];
       i++;
     }
     out[out1_l] = '\0';
@@ -1,15 +1,20 @@
 #include <iostream>
 #include <cstdlib>
 #include <cstring>
+#include <sys/stat.h>
 
 namespace bukreev
 {
   constexpr size_t initialSize = 4;
+  constexpr size_t charsetSize = 256;
+  constexpr size_t maxHint = 1 << 24;
 
-  char* inputString(std::istream& in, size_t& len);
+  size_t sizeHint(int fd);
+  char* inputString(std::istream& in, size_t& len, size_t hint);
 
-  char* growString(const char* oldStr, size_t& capacity);
+  char* growString(char* str, size_t& capacity);
 
+  char* compact(const char* str, const bool* keep, char* resStr);
   char* excsnd(const char* first, const char* second, char* resStr);
   char* latrmv(const char* str, char* resStr);
 }
@@ -18,7 +23,7 @@ int main()
 {
   size_t len = 0;
 
-  char* str = bukreev::inputString(std::cin, len);
+  char* str = bukreev::inputString(std::cin, len, bukreev::sizeHint(0));
   if (!str)
   {
     std::cerr << "Not enough memory for string input.\n";
@@ -66,11 +71,23 @@ int main()
   free(res2);
 }
 
-char* bukreev::inputString(std::istream& in, size_t& len)
+size_t bukreev::sizeHint(int fd)
 {
-  size_t capacity = initialSize;
+  struct stat info{};
+  if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0)
+  {
+    return initialSize;
+  }
 
-  char* buffer = reinterpret_cast< char* >(malloc(initialSize * sizeof(char)));
+  size_t size = info.st_size + 1;
+  return size < maxHint ? size : maxHint;
+}
+
+char* bukreev::inputString(std::istream& in, size_t& len, size_t hint)
+{
+  size_t capacity = hint < initialSize ? initialSize : hint;
+
+  char* buffer = reinterpret_cast< char* >(malloc(capacity * sizeof(char)));
   if (!buffer)
   {
     return nullptr;
@@ -84,15 +101,14 @@ char* bukreev::inputString(std::istream& in, size_t& len)
   {
     if (size >= capacity)
     {
-      char* oldBuffer = buffer;
-      buffer = growString(buffer, capacity);
-      free(oldBuffer);
-
-      if (!buffer)
+      char* newBuffer = growString(buffer, capacity);
+      if (!newBuffer)
       {
+        free(buffer);
         in >> std::skipws;
         return nullptr;
       }
+      buffer = newBuffer;
     }
 
     in >> c;
@@ -120,46 +136,30 @@ char* bukreev::inputString(std::istream& in, size_t& len)
   return buffer;
 }
 
-char* bukreev::growString(const char* oldStr, size_t& capacity)
+char* bukreev::growString(char* str, size_t& capacity)
 {
   constexpr double growRatio = 1.5;
   size_t newCapacity = capacity * growRatio;
 
-  char* newStr = reinterpret_cast< char* >(malloc(newCapacity * sizeof(char)));
+  char* newStr = reinterpret_cast< char* >(realloc(str, newCapacity * sizeof(char)));
   if (!newStr)
   {
     return nullptr;
   }
 
-  std::strncpy(newStr, oldStr, capacity);
   capacity = newCapacity;
 
   return newStr;
 }
 
-char* bukreev::excsnd(const char* first, const char* second, char* resStr)
+char* bukreev::compact(const char* str, const bool* keep, char* resStr)
 {
   size_t resIndex = 0;
 
-  for (size_t i = 0; first[i] != '\0'; i++)
+  for (size_t i = 0; str[i] != '\0'; i++)
   {
-    char c = first[i];
-    bool exclude = false;
-
-    for (size_t j = 0; second[j] != '\0'; j++)
-    {
-      if (second[j] == c)
-      {
-        exclude = true;
-        break;
-      }
-    }
-
-    if (!exclude)
-    {
-      resStr[resIndex] = c;
-      resIndex++;
-    }
+    resStr[resIndex] = str[i];
+    resIndex += keep[static_cast< unsigned char >(str[i])];
   }
 
   resStr[resIndex] = '\0';
@@ -167,20 +167,29 @@ char* bukreev::excsnd(const char* first, const char* second, char* resStr)
   return resStr;
 }
 
-char* bukreev::latrmv(const char* str, char* resStr)
+char* bukreev::excsnd(const char* first, const char* second, char* resStr)
 {
-  size_t resIndex = 0;
+  bool keep[charsetSize];
+  for (size_t c = 0; c < charsetSize; c++)
+  {
+    keep[c] = true;
+  }
 
-  for (size_t i = 0; str[i] != '\0'; i++)
+  for (size_t j = 0; second[j] != '\0'; j++)
   {
-    if (!std::isalpha(str[i]))
-    {
-      resStr[resIndex] = str[i];
-      resIndex++;
-    }
+    keep[static_cast< unsigned char >(second[j])] = false;
   }
 
-  resStr[resIndex] = '\0';
+  return compact(first, keep, resStr);
+}
 
-  return resStr;
+char* bukreev::latrmv(const char* str, char* resStr)
+{
+  bool keep[charsetSize];
+  for (size_t c = 0; c < charsetSize; c++)
+  {
+    keep[c] = !std::isalpha(c);
+  }
+
+  return compact(str, keep, resStr);
 }
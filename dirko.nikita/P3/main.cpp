@@ -1,8 +1,11 @@
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include "mtxActions.hpp"
 #include "mtxConvertion.hpp"
+#include "mtxPacking.hpp"
+#include "mtxSparse.hpp"
 
 int main(int argc, char **argv)
 {
@@ -14,18 +17,24 @@ int main(int argc, char **argv)
     std::cerr << "Too many arguments\n";
     return 1;
   }
-  if (argv[1][1] != '\0' || argv[1][0] > '2' || argv[1][0] < '1') {
+  bool pack = std::strcmp(argv[1], "--pack") == 0;
+  if (!pack && (argv[1][1] != '\0' || argv[1][0] > '2' || argv[1][0] < '1')) {
     std::cerr << "First parameter is not a number\n";
     return 1;
   }
-  int mode = std::atoi(argv[1]);
-  std::ifstream fin(argv[2]);
+  int mode = pack ? 2 : std::atoi(argv[1]);
+  std::ifstream fin(argv[2], std::ios::binary);
   if (!fin.is_open()) {
     std::cerr << "Cant open input file\n";
     return 2;
   }
   size_t rows = 0, cols = 0;
-  fin >> rows >> cols;
+  bool packed = dirko::isPacked(fin);
+  if (packed) {
+    dirko::inputPackedSize(fin, rows, cols);
+  } else {
+    fin >> rows >> cols;
+  }
   int staticMatrix[dirko::MAX_SIZE]{};
   int *matrix = nullptr;
   if (mode == 1) {
@@ -38,8 +47,23 @@ int main(int argc, char **argv)
       return 3;
     }
   }
-  dirko::inputMtx(fin, matrix, rows, cols);
+  dirko::SparseMtx sparse{};
+  if (packed) {
+    dirko::inputPackedMtx(fin, matrix, rows, cols);
+  } else {
+    try {
+      sparse = dirko::makeSparse(rows, cols);
+    } catch (const std::bad_alloc &e) {
+      if (mode == 2) {
+        delete[] matrix;
+      }
+      std::cerr << "Cant alloc\n";
+      return 3;
+    }
+    dirko::inputSparse(fin, sparse, matrix);
+  }
   if (fin.fail()) {
+    dirko::freeSparse(sparse);
     if (mode == 2) {
       delete[] matrix;
     }
@@ -47,27 +71,35 @@ int main(int argc, char **argv)
     return 2;
   }
   fin.close();
-  int *result1 = nullptr;
-  try {
-    result1 = new int[rows * cols];
-  } catch (const std::bad_alloc &e) {
+  bool result2 = false;
+  if (dirko::isSparse(sparse)) {
+    result2 = dirko::doLwrTriMtx(sparse);
+    dirko::toDense(sparse, matrix);
+    dirko::freeSparse(sparse);
+  } else {
+    result2 = dirko::doLwrTriMtx(matrix, rows, cols);
+  }
+  if (!pack) {
+    dirko::doLftBotClk(matrix, rows, cols);
+  }
+  std::ofstream fout(argv[3], std::ios::binary);
+  if (!fout.is_open()) {
     if (mode == 2) {
       delete[] matrix;
     }
-    std::cerr << "Cant alloc\n";
-    return 3;
-  }
-  dirko::copyMtx(matrix, result1, rows, cols);
-  dirko::doLftBotClk(result1, rows, cols);
-  bool result2 = dirko::doLwrTriMtx(matrix, rows, cols);
-  std::ofstream fout(argv[3]);
-  if (!fout.is_open()) {
     std::cerr << "Cant open output file\n";
     return 2;
   }
-  dirko::output(fout, result1, rows, cols) << '\n';
-  fout << std::boolalpha << result2 << '\n';
-  delete[] result1;
+  if (pack) {
+    dirko::outputPacked(fout, matrix, rows, cols);
+  } else if (packed) {
+    dirko::outputPacked(fout, matrix, rows, cols) << '\n';
+  } else {
+    dirko::output(fout, matrix, rows, cols) << '\n';
+  }
+  if (!pack) {
+    fout << std::boolalpha << result2 << '\n';
+  }
   if (mode == 2) {
     delete[] matrix;
   }
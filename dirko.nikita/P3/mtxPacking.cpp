@@ -0,0 +1,152 @@
+#include "mtxPacking.hpp"
+#include <iostream>
+#include <limits>
+
+namespace
+{
+  const long long intMin = std::numeric_limits< int >::min();
+  const long long intMax = std::numeric_limits< int >::max();
+
+  unsigned long long toZigzag(long long value)
+  {
+    return (static_cast< unsigned long long >(value) << 1) ^ static_cast< unsigned long long >(value >> 63);
+  }
+  long long fromZigzag(unsigned long long value)
+  {
+    return static_cast< long long >(value >> 1) ^ -static_cast< long long >(value & 1);
+  }
+  std::istream &inputVarint(std::istream &input, unsigned long long &value)
+  {
+    value = 0;
+    char ch = 0;
+    for (size_t shift = 0; shift < 64; shift += 7) {
+      if (!input.get(ch)) {
+        return input;
+      }
+      unsigned char byte = static_cast< unsigned char >(ch);
+      value |= static_cast< unsigned long long >(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) {
+        return input;
+      }
+    }
+    input.setstate(std::ios::failbit);
+    return input;
+  }
+  std::ostream &outputVarint(std::ostream &output, unsigned long long value)
+  {
+    while (value >= 0x80) {
+      output.put(static_cast< char >((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    return output.put(static_cast< char >(value));
+  }
+  std::ostream &outputLiteral(std::ostream &output, const long long *deltas, size_t count)
+  {
+    if (count == 0) {
+      return output;
+    }
+    outputVarint(output, count << 1);
+    for (size_t i = 0; i < count; ++i) {
+      outputVarint(output, toZigzag(deltas[i]));
+    }
+    return output;
+  }
+}
+
+bool dirko::isPacked(std::istream &input)
+{
+  return input.peek() == PACKED_TAG[0];
+}
+std::istream &dirko::inputPackedSize(std::istream &input, size_t &rows, size_t &cols)
+{
+  char tag[sizeof(PACKED_TAG) - 1]{};
+  if (!input.read(tag, sizeof(tag))) {
+    return input;
+  }
+  for (size_t i = 0; i < sizeof(tag); ++i) {
+    if (tag[i] != PACKED_TAG[i]) {
+      input.setstate(std::ios::failbit);
+      return input;
+    }
+  }
+  unsigned long long r = 0, c = 0;
+  if (inputVarint(input, r) && inputVarint(input, c)) {
+    rows = r;
+    cols = c;
+  }
+  return input;
+}
+std::istream &dirko::inputPackedMtx(std::istream &input, int *matrix, size_t rows, size_t cols)
+{
+  for (size_t i = 0; i < rows; ++i) {
+    int *row = matrix + i * cols;
+    long long prev = 0;
+    size_t j = 0;
+    while (j < cols) {
+      unsigned long long header = 0;
+      if (!inputVarint(input, header)) {
+        return input;
+      }
+      unsigned long long count = header >> 1;
+      if (count == 0 || count > cols - j) {
+        input.setstate(std::ios::failbit);
+        return input;
+      }
+      unsigned long long code = 0;
+      for (size_t k = 0; k < count; ++k) {
+        if ((k == 0 || !(header & 1)) && !inputVarint(input, code)) {
+          return input;
+        }
+        long long delta = fromZigzag(code);
+        if (delta < intMin - prev || delta > intMax - prev) {
+          input.setstate(std::ios::failbit);
+          return input;
+        }
+        prev += delta;
+        row[j++] = static_cast< int >(prev);
+      }
+    }
+  }
+  return input;
+}
+std::ostream &dirko::outputPacked(std::ostream &output, const int *matrix, size_t rows, size_t cols)
+{
+  output.write(PACKED_TAG, sizeof(PACKED_TAG) - 1);
+  outputVarint(output, rows);
+  outputVarint(output, cols);
+  long long *deltas = nullptr;
+  try {
+    deltas = new long long[cols];
+  } catch (const std::bad_alloc &e) {
+    output.setstate(std::ios::badbit);
+    return output;
+  }
+  for (size_t i = 0; i < rows; ++i) {
+    const int *row = matrix + i * cols;
+    long long prev = 0;
+    for (size_t j = 0; j < cols; ++j) {
+      deltas[j] = static_cast< long long >(row[j]) - prev;
+      prev = row[j];
+    }
+    size_t literal = 0;
+    size_t j = 0;
+    while (j < cols) {
+      size_t run = 1;
+      while (j + run < cols && deltas[j + run] == deltas[j]) {
+        ++run;
+      }
+      if (run < PACKED_RUN_MIN) {
+        j += run;
+        continue;
+      }
+      outputLiteral(output, deltas + literal, j - literal);
+      outputVarint(output, (run << 1) | 1);
+      outputVarint(output, toZigzag(deltas[j]));
+      j += run;
+      literal = j;
+    }
+    outputLiteral(output, deltas + literal, cols - literal);
+  }
+  delete[] deltas;
+  return output;
+}
@@ -0,0 +1,17 @@
+#ifndef MTX_PACKING
+#define MTX_PACKING
+#include <iosfwd>
+
+namespace dirko
+{
+  // Packed layout: "DMZ" tag, varint rows and cols, then for each row
+  // blocks of zigzag deltas: varint (count << 1 | isRun) followed by one
+  // delta for a run or count deltas for a literal block
+  const char PACKED_TAG[] = "DMZ";
+  const size_t PACKED_RUN_MIN = 3;
+  bool isPacked(std::istream &input);
+  std::istream &inputPackedSize(std::istream &input, size_t &rows, size_t &cols);
+  std::istream &inputPackedMtx(std::istream &input, int *matrix, size_t rows, size_t cols);
+  std::ostream &outputPacked(std::ostream &output, const int *matrix, size_t rows, size_t cols);
+}
+#endif
@@ -0,0 +1,98 @@
+#include "mtxSparse.hpp"
+#include <iostream>
+#include "mtxActions.hpp"
+
+namespace
+{
+  void scatter(const dirko::SparseMtx &sparse, int *matrix, size_t rows, size_t cells) noexcept
+  {
+    for (size_t k = 0; k < cells; ++k) {
+      matrix[k] = 0;
+    }
+    for (size_t i = 0; i < rows; ++i) {
+      for (size_t k = sparse.rowStart[i]; k < sparse.rowStart[i + 1]; ++k) {
+        matrix[i * sparse.cols + sparse.colIdx[k]] = sparse.values[k];
+      }
+    }
+  }
+}
+
+dirko::SparseMtx dirko::makeSparse(size_t rows, size_t cols)
+{
+  SparseMtx sparse{rows, cols, 0, rows * cols / SPARSE_RATIO, nullptr, nullptr, nullptr};
+  try {
+    sparse.rowStart = new size_t[rows + 1];
+    sparse.colIdx = new size_t[sparse.capacity];
+    sparse.values = new int[sparse.capacity];
+  } catch (const std::bad_alloc &e) {
+    freeSparse(sparse);
+    throw;
+  }
+  return sparse;
+}
+void dirko::freeSparse(SparseMtx &sparse) noexcept
+{
+  delete[] sparse.rowStart;
+  delete[] sparse.colIdx;
+  delete[] sparse.values;
+  sparse.rowStart = nullptr;
+  sparse.colIdx = nullptr;
+  sparse.values = nullptr;
+  sparse.nnz = 0;
+  sparse.capacity = 0;
+}
+bool dirko::isSparse(const SparseMtx &sparse) noexcept
+{
+  return sparse.values != nullptr;
+}
+std::istream &dirko::inputSparse(std::istream &input, SparseMtx &sparse, int *matrix)
+{
+  sparse.nnz = 0;
+  for (size_t i = 0; i < sparse.rows; ++i) {
+    sparse.rowStart[i] = sparse.nnz;
+    for (size_t j = 0; j < sparse.cols; ++j) {
+      int value = 0;
+      if (!(input >> value)) {
+        return input;
+      }
+      if (value == 0) {
+        continue;
+      }
+      if (sparse.nnz == sparse.capacity) {
+        size_t pos = i * sparse.cols + j;
+        sparse.rowStart[i + 1] = sparse.nnz;
+        scatter(sparse, matrix, i + 1, pos);
+        matrix[pos] = value;
+        freeSparse(sparse);
+        return inputMtx(input, matrix + pos + 1, sparse.rows * sparse.cols - pos - 1, 1);
+      }
+      sparse.colIdx[sparse.nnz] = j;
+      sparse.values[sparse.nnz++] = value;
+    }
+  }
+  sparse.rowStart[sparse.rows] = sparse.nnz;
+  return input;
+}
+void dirko::toDense(const SparseMtx &sparse, int *matrix) noexcept
+{
+  scatter(sparse, matrix, sparse.rows, sparse.rows * sparse.cols);
+}
+bool dirko::doLwrTriMtx(const SparseMtx &sparse)
+{
+  const size_t min = (sparse.rows > sparse.cols) ? sparse.cols : sparse.rows;
+  if (min < 2) {
+    return false;
+  }
+  for (size_t i = 0; i < sparse.rows; ++i) {
+    for (size_t k = sparse.rowStart[i]; k < sparse.rowStart[i + 1]; ++k) {
+      size_t pos = i * sparse.cols + sparse.colIdx[k];
+      if (pos >= min * min) {
+        return true;
+      }
+      if (pos % min > pos / min) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
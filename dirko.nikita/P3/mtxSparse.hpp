@@ -0,0 +1,23 @@
+#ifndef MTX_SPARSE
+#define MTX_SPARSE
+#include <iosfwd>
+
+namespace dirko
+{
+  const size_t SPARSE_RATIO = 20;
+  struct SparseMtx
+  {
+    size_t rows, cols;
+    size_t nnz, capacity;
+    size_t *rowStart;
+    size_t *colIdx;
+    int *values;
+  };
+  SparseMtx makeSparse(size_t rows, size_t cols);
+  void freeSparse(SparseMtx &sparse) noexcept;
+  bool isSparse(const SparseMtx &sparse) noexcept;
+  std::istream &inputSparse(std::istream &input, SparseMtx &sparse, int *matrix);
+  void toDense(const SparseMtx &sparse, int *matrix) noexcept;
+  bool doLwrTriMtx(const SparseMtx &sparse);
+}
+#endif
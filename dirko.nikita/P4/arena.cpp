@@ -0,0 +1,38 @@
+#include "arena.hpp"
+#include <cstdlib>
+
+bool dirko::reserveArena(Arena &arena, size_t size)
+{
+  if (size <= arena.capacity - arena.used) {
+    return true;
+  }
+  size_t capacity = arena.capacity * 2;
+  if (capacity < arena.used + size) {
+    capacity = arena.used + size;
+  }
+  char *data = reinterpret_cast< char * >(realloc(arena.data, sizeof(char) * capacity));
+  if (data == nullptr) {
+    return false;
+  }
+  arena.data = data;
+  arena.capacity = capacity;
+  return true;
+}
+char *dirko::allocate(Arena &arena, size_t size) noexcept
+{
+  if (arena.capacity - arena.used < size) {
+    return nullptr;
+  }
+  char *block = arena.data + arena.used;
+  arena.used += size;
+  return block;
+}
+void dirko::resetArena(Arena &arena) noexcept
+{
+  arena.used = 0;
+}
+void dirko::freeArena(Arena &arena) noexcept
+{
+  free(arena.data);
+  arena = Arena{nullptr, 0, 0};
+}
@@ -0,0 +1,18 @@
+#ifndef ARENA
+#define ARENA
+#include <cstddef>
+
+namespace dirko
+{
+  struct Arena
+  {
+    char *data;
+    size_t capacity;
+    size_t used;
+  };
+  bool reserveArena(Arena &arena, size_t size);
+  char *allocate(Arena &arena, size_t size) noexcept;
+  void resetArena(Arena &arena) noexcept;
+  void freeArena(Arena &arena) noexcept;
+}
+#endif
@@ -0,0 +1,51 @@
+#ifndef CHAR_CLASS
+#define CHAR_CLASS
+#include <cstddef>
+#ifdef DIRKO_LOCALE_CTYPE
+#include <cctype>
+#endif
+
+namespace dirko
+{
+  const size_t classTableSize = 256;
+  const unsigned char classAlpha = 1;
+  const unsigned char classLatin = 2;
+  struct ClassTable
+  {
+    unsigned char flags[classTableSize];
+  };
+  constexpr ClassTable makeClassTable() noexcept
+  {
+    ClassTable table{};
+    for (size_t ch = 0; ch < classTableSize; ++ch) {
+      unsigned char flags = 0;
+      if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z')) {
+        flags |= classAlpha | classLatin;
+      }
+      table.flags[ch] = flags;
+    }
+    return table;
+  }
+  constexpr ClassTable classTable = makeClassTable();
+
+#ifdef DIRKO_LOCALE_CTYPE
+  inline bool isAlpha(unsigned char ch) noexcept
+  {
+    return std::isalpha(ch);
+  }
+  inline unsigned char toLower(unsigned char ch) noexcept
+  {
+    return std::tolower(ch);
+  }
+#else
+  inline bool isAlpha(unsigned char ch) noexcept
+  {
+    return classTable.flags[ch] & classAlpha;
+  }
+  inline unsigned char toLower(unsigned char ch) noexcept
+  {
+    return (classTable.flags[ch] & classLatin) ? ch | ('a' - 'A') : ch;
+  }
+#endif
+}
+#endif
@@ -0,0 +1,56 @@
+#include "charSet.hpp"
+
+namespace
+{
+  size_t popCount(unsigned long long word) noexcept
+  {
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (word * 0x0101010101010101ULL) >> 56;
+  }
+}
+
+void dirko::insert(CharSet &set, unsigned char ch) noexcept
+{
+  set.bits[ch >> 6] |= 1ULL << (ch & 63);
+}
+void dirko::insert(CharSet &set, const char *str, size_t size) noexcept
+{
+  unsigned long long bits[setWords] = {};
+  const unsigned char *data = reinterpret_cast< const unsigned char * >(str);
+  for (size_t i = 0; i < size; ++i) {
+    bits[data[i] >> 6] |= 1ULL << (data[i] & 63);
+  }
+  for (size_t i = 0; i < setWords; ++i) {
+    set.bits[i] |= bits[i];
+  }
+}
+bool dirko::test(const CharSet &set, unsigned char ch) noexcept
+{
+  return (set.bits[ch >> 6] >> (ch & 63)) & 1;
+}
+dirko::CharSet dirko::unite(const CharSet &lhs, const CharSet &rhs) noexcept
+{
+  CharSet result{};
+  for (size_t i = 0; i < setWords; ++i) {
+    result.bits[i] = lhs.bits[i] | rhs.bits[i];
+  }
+  return result;
+}
+dirko::CharSet dirko::subtract(const CharSet &lhs, const CharSet &rhs) noexcept
+{
+  CharSet result{};
+  for (size_t i = 0; i < setWords; ++i) {
+    result.bits[i] = lhs.bits[i] & ~rhs.bits[i];
+  }
+  return result;
+}
+size_t dirko::count(const CharSet &set) noexcept
+{
+  size_t result = 0;
+  for (size_t i = 0; i < setWords; ++i) {
+    result += popCount(set.bits[i]);
+  }
+  return result;
+}
@@ -0,0 +1,19 @@
+#ifndef CHAR_SET
+#define CHAR_SET
+#include <cstddef>
+
+namespace dirko
+{
+  const size_t setWords = 4;
+  struct CharSet
+  {
+    unsigned long long bits[setWords];
+  };
+  void insert(CharSet &set, unsigned char ch) noexcept;
+  void insert(CharSet &set, const char *str, size_t size) noexcept;
+  bool test(const CharSet &set, unsigned char ch) noexcept;
+  CharSet unite(const CharSet &lhs, const CharSet &rhs) noexcept;
+  CharSet subtract(const CharSet &lhs, const CharSet &rhs) noexcept;
+  size_t count(const CharSet &set) noexcept;
+}
+#endif
@@ -1,51 +1,37 @@
 #include "getLine.hpp"
 #include <iostream>
-#include "extendSize.hpp"
 
-char *dirko::getLine(std::istream &in, size_t &size)
+char *dirko::getLine(std::istream &in, Arena &arena, size_t &size)
 {
-  size_t copasity = 1;
-  bool isSkipWp = in.flags() & std::ios::skipws;
-  if (isSkipWp) {
-    in >> std::noskipws;
+  size = 0;
+  if (!reserveArena(arena, initCapacity)) {
+    return nullptr;
   }
-  char *str = reinterpret_cast< char * >(malloc(sizeof(char) * copasity));
-  if (str == nullptr) {
-    if (isSkipWp) {
-      in >> std::skipws;
+  arena.data[arena.used] = '\0';
+  do {
+    if (!reserveArena(arena, size + 2)) {
+      return nullptr;
     }
-    return str;
-  }
-  char ch = 0;
-  while (in >> ch && ch != '\n') {
-    if (size == copasity) {
-      char *tmp = extendSize(str, size);
-      free(str);
-      if (tmp == nullptr) {
-        str = nullptr;
-        if (isSkipWp) {
-          in >> std::skipws;
-        }
-        return str;
-      }
-      str = tmp;
-      copasity *= 2;
-    }
-    str[size++] = ch;
+  } while (readPart(in, arena.data + arena.used, size, arena.capacity - arena.used));
+  return allocate(arena, size + 1);
+}
+bool dirko::readPart(std::istream &in, char *str, size_t &size, size_t copasity)
+{
+  in.getline(str + size, copasity - size);
+  size_t count = in.gcount();
+  if (in.eof()) {
+    size += count;
+    in.setstate(std::ios::failbit);
+    return false;
   }
-  if (isSkipWp) {
-    in >> std::skipws;
+  if (!in.fail()) {
+    size += count - 1;
+    return false;
   }
-  if (size == copasity) {
-    char *tmp = extendSize(str, size);
-    free(str);
-    if (tmp == nullptr) {
-      str = nullptr;
-      return str;
-    }
-    str = tmp;
-    copasity *= 2;
+  if (count == 0) {
+    return false;
   }
-  str[size] = '\0';
-  return str;
+  size += count;
+  in.clear(in.rdstate() & ~std::ios::failbit);
+  return true;
 }
@@ -1,9 +1,12 @@
 #ifndef GET_LINE
 #define GET_LINE
 #include <iosfwd>
+#include "arena.hpp"
 
 namespace dirko
 {
-  char *getLine(std::istream &in, size_t &size);
+  const size_t initCapacity = 64;
+  char *getLine(std::istream &in, Arena &arena, size_t &size);
+  bool readPart(std::istream &in, char *str, size_t &size, size_t copasity);
 }
 #endif
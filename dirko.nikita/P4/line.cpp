@@ -0,0 +1,91 @@
+#include "line.hpp"
+#include <cstring>
+#include <iostream>
+#include "getLine.hpp"
+
+dirko::Line::Line() noexcept:
+  data_(inline_),
+  size_(0),
+  capacity_(inlineCapacity),
+  inline_()
+{}
+dirko::Line::Line(Line &&other) noexcept:
+  Line()
+{
+  steal_(other);
+}
+dirko::Line::~Line() noexcept
+{
+  if (!isInline()) {
+    delete[] data_;
+  }
+}
+dirko::Line &dirko::Line::operator=(Line &&other) noexcept
+{
+  if (this != &other) {
+    if (!isInline()) {
+      delete[] data_;
+    }
+    data_ = inline_;
+    capacity_ = inlineCapacity;
+    steal_(other);
+  }
+  return *this;
+}
+const char *dirko::Line::data() const noexcept
+{
+  return data_;
+}
+size_t dirko::Line::size() const noexcept
+{
+  return size_;
+}
+bool dirko::Line::isInline() const noexcept
+{
+  return data_ == inline_;
+}
+dirko::Line::operator Span() const noexcept
+{
+  return makeSpan(data_, size_);
+}
+std::istream &dirko::Line::read(std::istream &in)
+{
+  size_ = 0;
+  data_[0] = '\0';
+  do {
+    if (capacity_ - size_ < 2) {
+      grow_(capacity_ * 2);
+    }
+  } while (readPart(in, data_, size_, capacity_));
+  return in;
+}
+void dirko::Line::grow_(size_t capacity)
+{
+  char *tmp = new char[capacity];
+  std::memcpy(tmp, data_, size_ + 1);
+  if (!isInline()) {
+    delete[] data_;
+  }
+  data_ = tmp;
+  capacity_ = capacity;
+}
+void dirko::Line::steal_(Line &other) noexcept
+{
+  size_ = other.size_;
+  if (other.isInline()) {
+    std::memcpy(inline_, other.inline_, size_ + 1);
+  } else {
+    data_ = other.data_;
+    capacity_ = other.capacity_;
+    other.data_ = other.inline_;
+    other.capacity_ = inlineCapacity;
+  }
+  other.size_ = 0;
+  other.inline_[0] = '\0';
+}
+dirko::Line dirko::getLine(std::istream &in)
+{
+  Line line;
+  line.read(in);
+  return line;
+}
@@ -0,0 +1,34 @@
+#ifndef LINE
+#define LINE
+#include <cstddef>
+#include <iosfwd>
+#include "span.hpp"
+
+namespace dirko
+{
+  const size_t inlineCapacity = 64;
+  struct Line final
+  {
+    Line() noexcept;
+    Line(const Line &) = delete;
+    Line(Line &&) noexcept;
+    ~Line() noexcept;
+    Line &operator=(const Line &) = delete;
+    Line &operator=(Line &&) noexcept;
+    const char *data() const noexcept;
+    size_t size() const noexcept;
+    bool isInline() const noexcept;
+    operator Span() const noexcept;
+    std::istream &read(std::istream &in);
+
+  private:
+    char *data_;
+    size_t size_;
+    size_t capacity_;
+    char inline_[inlineCapacity];
+    void grow_(size_t capacity);
+    void steal_(Line &other) noexcept;
+  };
+  Line getLine(std::istream &in);
+}
+#endif
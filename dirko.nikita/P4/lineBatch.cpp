@@ -0,0 +1,89 @@
+#include "lineBatch.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <thread>
+#include "strActions.hpp"
+
+namespace
+{
+  const size_t maxBatchWorkers = 16;
+}
+
+bool dirko::prepareBatch(LineBatch &batch, const Span *spans, size_t lines)
+{
+  if (lines > batch.capacity) {
+    size_t *offsets = reinterpret_cast< size_t * >(malloc(sizeof(size_t) * (lines + 1)));
+    size_t *counts = reinterpret_cast< size_t * >(malloc(sizeof(size_t) * lines));
+    if (offsets == nullptr || counts == nullptr) {
+      free(offsets);
+      free(counts);
+      return false;
+    }
+    free(batch.offsets);
+    free(batch.counts);
+    batch.offsets = offsets;
+    batch.counts = counts;
+    batch.capacity = lines;
+  }
+  batch.offsets[0] = 0;
+  for (size_t i = 0; i < lines; ++i) {
+    batch.offsets[i + 1] = batch.offsets[i] + spans[i].size;
+  }
+  size_t total = batch.offsets[lines];
+  if (total > batch.arenaSize) {
+    char *arena = reinterpret_cast< char * >(malloc(sizeof(char) * total));
+    if (arena == nullptr) {
+      return false;
+    }
+    free(batch.arena);
+    batch.arena = arena;
+    batch.arenaSize = total;
+  }
+  return true;
+}
+void dirko::doBatch(const Span *spans, LineBatch &batch, size_t begin, size_t end)
+{
+  for (size_t i = begin; i < end; ++i) {
+    batch.counts[i] = doDifLat(spans[i].data, spans[i].size);
+    doUppLow(spans[i].data, spans[i].size, batch.arena + batch.offsets[i]);
+  }
+}
+void dirko::runBatch(const Span *spans, LineBatch &batch, size_t lines, size_t workers)
+{
+  workers = workers < lines ? workers : lines;
+  workers = workers < maxBatchWorkers ? workers : maxBatchWorkers;
+  if (workers < 2) {
+    doBatch(spans, batch, 0, lines);
+    return;
+  }
+  size_t bounds[maxBatchWorkers + 1] = {};
+  size_t total = batch.offsets[lines];
+  for (size_t part = 1; part < workers; ++part) {
+    size_t *from = batch.offsets + bounds[part - 1];
+    size_t *bound = std::lower_bound(from, batch.offsets + lines, total / workers * part);
+    bounds[part] = bound - batch.offsets;
+  }
+  bounds[workers] = lines;
+  std::thread threads[maxBatchWorkers];
+  size_t started = 1;
+  try {
+    for (; started < workers; ++started) {
+      threads[started] = std::thread(doBatch, spans, std::ref(batch), bounds[started], bounds[started + 1]);
+    }
+  } catch (const std::exception &) {
+    doBatch(spans, batch, bounds[started], lines);
+  }
+  doBatch(spans, batch, 0, bounds[1]);
+  for (size_t part = 1; part < started; ++part) {
+    threads[part].join();
+  }
+}
+void dirko::freeBatch(LineBatch &batch) noexcept
+{
+  free(batch.arena);
+  free(batch.offsets);
+  free(batch.counts);
+  batch = LineBatch{nullptr, 0, nullptr, nullptr, 0};
+}
@@ -0,0 +1,22 @@
+#ifndef LINE_BATCH
+#define LINE_BATCH
+#include <cstddef>
+#include "span.hpp"
+
+namespace dirko
+{
+  const size_t batchLines = 10000;
+  struct LineBatch
+  {
+    char *arena;
+    size_t arenaSize;
+    size_t *offsets;
+    size_t *counts;
+    size_t capacity;
+  };
+  bool prepareBatch(LineBatch &batch, const Span *spans, size_t lines);
+  void doBatch(const Span *spans, LineBatch &batch, size_t begin, size_t end);
+  void runBatch(const Span *spans, LineBatch &batch, size_t lines, size_t workers);
+  void freeBatch(LineBatch &batch) noexcept;
+}
+#endif
@@ -1,37 +1,76 @@
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
-#include "getLine.hpp"
+#include "line.hpp"
+#include "mapLine.hpp"
 #include "strActions.hpp"
+#include "streamLines.hpp"
 
-int main()
+int main(int argc, char **argv)
 {
-  size_t size = 0;
-  char *str = dirko::getLine(std::cin, size);
-  if (str == nullptr) {
-    std::cerr << "Cant alloc\n";
-    return 1;
+  if (argc > 1 && std::strcmp(argv[1], "--stream") == 0) {
+    std::ios_base::sync_with_stdio(false);
+    dirko::LineMap map{nullptr, 0, 0};
+    bool isOk = false;
+    if (dirko::mapInput(0, map)) {
+      isOk = dirko::streamLines(map, std::cout);
+    } else {
+      isOk = dirko::streamLines(std::cin, std::cout);
+    }
+    dirko::unmapInput(map);
+    if (!isOk) {
+      std::cerr << "Cant alloc\n";
+      return 1;
+    }
+    return 0;
   }
-  if (std::cin.fail()) {
-    free(str);
-    std::cerr << "Cant read\n";
-    return 1;
+  bool isUtf8 = argc > 1 && std::strcmp(argv[1], "--utf8") == 0;
+  size_t size = 0;
+  dirko::Line text;
+  dirko::Span view{nullptr, 0};
+  dirko::LineMap map{nullptr, 0, 0};
+  if (dirko::mapInput(0, map)) {
+    size_t pos = 0;
+    const char *line = dirko::nextLine(map, pos, size);
+    if (pos > map.size) {
+      dirko::unmapInput(map);
+      std::cerr << "Cant read\n";
+      return 1;
+    }
+    view = dirko::makeSpan(line, size);
+  } else {
+    try {
+      text = dirko::getLine(std::cin);
+    } catch (const std::bad_alloc &) {
+      std::cerr << "Cant alloc\n";
+      return 1;
+    }
+    if (std::cin.fail()) {
+      std::cerr << "Cant read\n";
+      return 1;
+    }
+    size = text.size();
+    view = text;
   }
   if (size == 0) {
-    free(str);
+    dirko::unmapInput(map);
     std::cerr << "Empty string\n";
     return 1;
   }
-  size_t result1 = dirko::doDifLat(str);
   char *result2 = reinterpret_cast< char * >(malloc(sizeof(char) * (size + 1)));
   if (result2 == nullptr) {
-    free(str);
+    dirko::unmapInput(map);
     std::cerr << "Cant alloc\n";
     return 1;
   }
-  result2[size] = '\0';
-  dirko::doUppLow(str, result2);
+  size_t result1 = dirko::doDifLat(view);
+  if (isUtf8) {
+    result1 += dirko::doDifCyr(view.data, view.size);
+  }
+  dirko::doUppLow(view, result2);
+  result2[view.size] = '\0';
   std::cout << result1 << '\n';
   std::cout << result2 << '\n';
-  free(str);
   free(result2);
+  dirko::unmapInput(map);
 }
@@ -0,0 +1,57 @@
+#include "mapLine.hpp"
+#include <cstring>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool dirko::mapInput(int fd, LineMap &map)
+{
+#if defined(__unix__) || defined(__APPLE__)
+  struct stat info = {};
+  if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+    return false;
+  }
+  off_t offset = lseek(fd, 0, SEEK_CUR);
+  if (offset < 0 || offset >= info.st_size) {
+    return false;
+  }
+  size_t length = info.st_size;
+  void *base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (base == MAP_FAILED) {
+    return false;
+  }
+  map.offset = offset;
+  map.data = reinterpret_cast< const char * >(base) + map.offset;
+  map.size = length - map.offset;
+  return true;
+#else
+  static_cast< void >(fd);
+  static_cast< void >(map);
+  return false;
+#endif
+}
+void dirko::unmapInput(LineMap &map)
+{
+#if defined(__unix__) || defined(__APPLE__)
+  if (map.data != nullptr) {
+    munmap(const_cast< char * >(map.data - map.offset), map.size + map.offset);
+  }
+#endif
+  map.data = nullptr;
+  map.size = 0;
+  map.offset = 0;
+}
+const char *dirko::nextLine(const LineMap &map, size_t &pos, size_t &len)
+{
+  if (pos >= map.size) {
+    len = 0;
+    return nullptr;
+  }
+  const char *line = map.data + pos;
+  const void *end = std::memchr(line, '\n', map.size - pos);
+  len = (end == nullptr) ? map.size - pos : reinterpret_cast< const char * >(end) - line;
+  pos += len + 1;
+  return line;
+}
@@ -0,0 +1,17 @@
+#ifndef MAP_LINE
+#define MAP_LINE
+#include <cstddef>
+
+namespace dirko
+{
+  struct LineMap
+  {
+    const char *data;
+    size_t size;
+    size_t offset;
+  };
+  bool mapInput(int fd, LineMap &map);
+  void unmapInput(LineMap &map);
+  const char *nextLine(const LineMap &map, size_t &pos, size_t &len);
+}
+#endif
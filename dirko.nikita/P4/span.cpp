@@ -0,0 +1,9 @@
+#include "span.hpp"
+#include <cstring>
+
+dirko::Span dirko::makeSpan(const char *line, size_t size) noexcept
+{
+  const void *nul = std::memchr(line, '\0', size);
+  size_t length = (nul == nullptr) ? size : reinterpret_cast< const char * >(nul) - line;
+  return Span{line, length};
+}
@@ -0,0 +1,14 @@
+#ifndef SPAN
+#define SPAN
+#include <cstddef>
+
+namespace dirko
+{
+  struct Span
+  {
+    const char *data;
+    size_t size;
+  };
+  Span makeSpan(const char *line, size_t size) noexcept;
+}
+#endif
@@ -1,32 +1,149 @@
 #include "strActions.hpp"
-#include <cctype>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include "charClass.hpp"
+#include "charSet.hpp"
 
-const char *dirko::find(const char *start, const char *end, char target)
+namespace
 {
-  for (const char *ch = start; ch < end; ++ch) {
-    if (*ch == target) {
-      return ch;
+#ifndef DIRKO_LOCALE_CTYPE
+  const unsigned long long lowBits = 0x7f7f7f7f7f7f7f7fULL;
+  const unsigned long long highBits = 0x8080808080808080ULL;
+  const unsigned long long ones = 0x0101010101010101ULL;
+
+  unsigned long long lowerWord(unsigned long long word) noexcept
+  {
+    unsigned long long heptets = word & lowBits;
+    unsigned long long aboveZ = heptets + ones * (0x7f - 'Z');
+    unsigned long long fromA = heptets + ones * (0x80 - 'A');
+    unsigned long long upper = ~word & (fromA ^ aboveZ) & highBits;
+    return word | (upper >> 2);
+  }
+#endif
+  const unsigned cyrBase = 0x400;
+  const unsigned cyrUpperYo = 0x401;
+  const unsigned cyrLowerYo = 0x451;
+  const unsigned cyrUpperA = 0x410;
+  const unsigned cyrLowerA = 0x430;
+  const unsigned cyrLowerYa = 0x44f;
+
+  unsigned foldCyrillic(unsigned code) noexcept
+  {
+    if (code == cyrUpperYo) {
+      return cyrLowerYo;
     }
+    return (code >= cyrUpperA && code < cyrLowerA) ? code + (cyrLowerA - cyrUpperA) : code;
+  }
+  const size_t parallelThreshold = 1 << 20;
+  const size_t maxWorkers = 16;
+
+  dirko::CharSet collect(const char *str, size_t size, size_t workers)
+  {
+    workers = workers < maxWorkers ? workers : maxWorkers;
+    dirko::CharSet parts[maxWorkers] = {};
+    if (workers < 2) {
+      dirko::insert(parts[0], str, size);
+      return parts[0];
+    }
+    size_t chunk = (size + workers - 1) / workers;
+    auto scan = [str, size, chunk, &parts](size_t part) noexcept
+    {
+      size_t begin = part * chunk < size ? part * chunk : size;
+      size_t end = begin + chunk < size ? begin + chunk : size;
+      dirko::insert(parts[part], str + begin, end - begin);
+    };
+    std::thread threads[maxWorkers];
+    size_t started = 1;
+    try {
+      for (; started < workers; ++started) {
+        threads[started] = std::thread(scan, started);
+      }
+    } catch (const std::exception &) {
+      for (size_t part = started; part < workers; ++part) {
+        scan(part);
+      }
+    }
+    scan(0);
+    dirko::CharSet seen = parts[0];
+    for (size_t part = 1; part < workers; ++part) {
+      if (part < started) {
+        threads[part].join();
+      }
+      seen = dirko::unite(seen, parts[part]);
+    }
+    return seen;
   }
-  return end;
 }
-size_t dirko::doDifLat(const char *str)
+
+size_t dirko::pickWorkers(size_t size) noexcept
 {
-  size_t count = 0;
-  char seen[alphaSize] = {};
-  for (const char *ch = str; *ch != '\0'; ++ch) {
-    if (std::isalpha(*ch)) {
-      if (dirko::find(seen, seen + count, std::tolower(*ch)) == seen + count) {
-        seen[count++] = std::tolower(*ch);
-      }
+  if (size < 2 * parallelThreshold) {
+    return 1;
+  }
+  static const size_t cores = std::thread::hardware_concurrency();
+  size_t most = size / parallelThreshold;
+  size_t workers = cores < most ? cores : most;
+  workers = workers < maxWorkers ? workers : maxWorkers;
+  return workers == 0 ? 1 : workers;
+}
+size_t dirko::doDifLat(const char *str, size_t size)
+{
+  return doDifLat(str, size, pickWorkers(size));
+}
+size_t dirko::doDifLat(const char *str, size_t size, size_t workers)
+{
+  CharSet seen = collect(str, size, workers);
+  CharSet letters{};
+  for (size_t ch = 0; ch < 256; ++ch) {
+    if (test(seen, ch) && isAlpha(ch)) {
+      insert(letters, toLower(ch));
+    }
+  }
+  return count(letters);
+}
+size_t dirko::doDifCyr(const char *str, size_t size)
+{
+  const unsigned char *data = reinterpret_cast< const unsigned char * >(str);
+  CharSet letters{};
+  for (size_t i = 0; i + 1 < size; ++i) {
+    if ((data[i] & 0xfe) != 0xd0 || (data[i + 1] & 0xc0) != 0x80) {
+      continue;
+    }
+    unsigned code = ((data[i] & 0x1fu) << 6) | (data[i + 1] & 0x3fu);
+    ++i;
+    if (code == cyrUpperYo || code == cyrLowerYo || (code >= cyrUpperA && code <= cyrLowerYa)) {
+      insert(letters, foldCyrillic(code) - cyrBase);
     }
   }
-  return count;
+  return count(letters);
 }
-char *dirko::doUppLow(const char *source, char *distention)
+char *dirko::doUppLow(const char *source, size_t size, char *distention)
 {
-  for (size_t i = 0; source[i] != '\0'; ++i) {
-    distention[i] = (std::isalpha(source[i])) ? std::tolower(source[i]) : source[i];
+  size_t i = 0;
+#ifndef DIRKO_LOCALE_CTYPE
+  const size_t step = sizeof(unsigned long long);
+  for (; i + step <= size; i += step) {
+    unsigned long long word = 0;
+    std::memcpy(&word, source + i, step);
+    word = lowerWord(word);
+    std::memcpy(distention + i, &word, step);
+  }
+#endif
+  for (; i < size; ++i) {
+    distention[i] = toLower(source[i]);
   }
   return distention;
 }
+char *dirko::doUppLow(char *str, size_t size)
+{
+  return doUppLow(str, size, str);
+}
+size_t dirko::doDifLat(Span line)
+{
+  return doDifLat(line.data, line.size);
+}
+char *dirko::doUppLow(Span line, char *distention)
+{
+  return doUppLow(line.data, line.size, distention);
+}
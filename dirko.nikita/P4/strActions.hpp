@@ -1,12 +1,17 @@
 #ifndef STR_ACTIONS
 #define STR_ACTIONS
 #include <cstddef>
+#include "span.hpp"
 
 namespace dirko
 {
-  const size_t alphaSize = 26;
-  const char *find(const char *start, const char *end, char target);
-  size_t doDifLat(const char *str);
-  char *doUppLow(const char *source, char *distention);
+  size_t pickWorkers(size_t size) noexcept;
+  size_t doDifLat(const char *str, size_t size);
+  size_t doDifLat(const char *str, size_t size, size_t workers);
+  size_t doDifCyr(const char *str, size_t size);
+  char *doUppLow(const char *source, size_t size, char *distention);
+  char *doUppLow(char *str, size_t size);
+  size_t doDifLat(Span line);
+  char *doUppLow(Span line, char *distention);
 }
 #endif
@@ -0,0 +1,72 @@
+#include "streamLines.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include "arena.hpp"
+#include "getLine.hpp"
+#include "lineBatch.hpp"
+#include "strActions.hpp"
+
+namespace
+{
+  bool processLine(std::ostream &out, dirko::Arena &arena, size_t size)
+  {
+    if (!dirko::reserveArena(arena, size)) {
+      return false;
+    }
+    const char *line = arena.data;
+    const void *nul = std::memchr(line, '\0', size);
+    size_t length = (nul == nullptr) ? size : reinterpret_cast< const char * >(nul) - line;
+    char *result = dirko::allocate(arena, length);
+    out << dirko::doDifLat(line, length) << '\n';
+    out.write(dirko::doUppLow(line, length, result), length) << '\n';
+    return true;
+  }
+}
+
+bool dirko::streamLines(std::istream &in, std::ostream &out)
+{
+  Arena arena{nullptr, 0, 0};
+  bool isOk = true;
+  while (isOk && in) {
+    resetArena(arena);
+    size_t size = 0;
+    if (getLine(in, arena, size) == nullptr) {
+      isOk = false;
+    } else if (in || size != 0) {
+      isOk = processLine(out, arena, size);
+    }
+  }
+  freeArena(arena);
+  return isOk;
+}
+bool dirko::streamLines(const LineMap &map, std::ostream &out)
+{
+  Span *spans = reinterpret_cast< Span * >(malloc(sizeof(Span) * batchLines));
+  if (spans == nullptr) {
+    return false;
+  }
+  LineBatch batch{nullptr, 0, nullptr, nullptr, 0};
+  bool isOk = true;
+  size_t pos = 0;
+  size_t size = 0;
+  const char *line = nextLine(map, pos, size);
+  while (isOk && line != nullptr) {
+    size_t lines = 0;
+    while (lines < batchLines && line != nullptr) {
+      spans[lines++] = makeSpan(line, size);
+      line = nextLine(map, pos, size);
+    }
+    isOk = prepareBatch(batch, spans, lines);
+    if (isOk) {
+      runBatch(spans, batch, lines, pickWorkers(batch.offsets[lines]));
+      for (size_t i = 0; i < lines; ++i) {
+        out << batch.counts[i] << '\n';
+        out.write(batch.arena + batch.offsets[i], spans[i].size) << '\n';
+      }
+    }
+  }
+  freeBatch(batch);
+  free(spans);
+  return isOk;
+}
@@ -0,0 +1,11 @@
+#ifndef STREAM_LINES
+#define STREAM_LINES
+#include <iosfwd>
+#include "mapLine.hpp"
+
+namespace dirko
+{
+  bool streamLines(std::istream &in, std::ostream &out);
+  bool streamLines(const LineMap &map, std::ostream &out);
+}
+#endif
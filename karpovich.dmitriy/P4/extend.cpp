@@ -1,13 +1,14 @@
 #include "extend.hpp"
 #include <iostream>
-char* karpovich::extend(char* old_str, size_t old_size)
+#include <cstring>
+char* karpovich::extend(const char* old_str, size_t old_size, size_t new_capacity)
 {
-  char* new_str = reinterpret_cast< char* >(malloc(old_size + 1));
+  char* new_str = reinterpret_cast< char* >(malloc(new_capacity));
   if (new_str == nullptr) {
     return nullptr;
   }
-  for (size_t i = 0; i < old_size; ++i) {
-    new_str[i] = old_str[i];
+  if (old_size != 0) {
+    std::memcpy(new_str, old_str, old_size);
   }
   return new_str;
 }
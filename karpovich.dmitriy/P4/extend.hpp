@@ -3,6 +3,7 @@
 #include <iosfwd>
 namespace karpovich
 {
-  char* extend(char* old_str, size_t old_size);
+  const size_t INIT_CAPACITY = 16;
+  char* extend(const char* old_str, size_t old_size, size_t new_capacity);
 }
 #endif
@@ -3,39 +3,35 @@
 #include "extend.hpp"
 char* karpovich::getline(std::istream& in, size_t& s)
 {
-  bool is_skipws = in.flags() & std::ios_base::skipws;
-  if (is_skipws) {
-    in >> std::noskipws;
+  size_t capacity = INIT_CAPACITY;
+  char* str = extend(nullptr, 0, capacity);
+  if (str == nullptr) {
+    return nullptr;
   }
-  char* str = nullptr;
-  char ch = '\0';
-  while (in >> ch && ch != '\n') {
-    char* temp = extend(str, s);
-    if (temp == nullptr) {
+  str[s] = '\0';
+  while (true) {
+    if (capacity - s < 2) {
+      char* temp = extend(str, s, capacity * 2);
       free(str);
-      if (is_skipws) {
-        in >> std::skipws;
+      if (temp == nullptr) {
+        return nullptr;
       }
-      return nullptr;
+      str = temp;
+      capacity *= 2;
     }
-    free(str);
-    str = temp;
-    str[s] = ch;
-    ++s;
-  }
-  char* temp = extend(str, s);
-  if (temp == nullptr) {
-    free(str);
-    if (is_skipws) {
-      in >> std::skipws;
+    in.getline(str + s, capacity - s);
+    size_t count = in.gcount();
+    if (in.eof() || count == 0) {
+      s += count;
+      break;
     }
-    return nullptr;
+    if (!in.fail()) {
+      s += count - 1;
+      break;
+    }
+    s += count;
+    in.clear(in.rdstate() & ~std::ios_base::failbit);
   }
-  free(str);
-  str = temp;
   str[s] = '\0';
-  if (is_skipws) {
-    in >> std::skipws;
-  }
   return str;
 }
@@ -1,46 +1,150 @@
 #include "strChange.hpp"
 #include <iostream>
-char* karpovich::repsym(const char* str, char* data)
+#include <cstring>
+#include <exception>
+#include <algorithm>
+#include <thread>
+namespace
 {
   constexpr size_t MAX_ascii = 256;
-  if (!str || !data) {
-    return nullptr;
+  constexpr size_t NO_POS = static_cast< size_t >(-1);
+  struct SymStats
+  {
+    size_t repeat[MAX_ascii];
+    size_t first[MAX_ascii];
+  };
+  void countSym(const char* str, size_t begin, size_t end, SymStats& stats)
+  {
+    for (size_t c = 0; c < MAX_ascii; ++c) {
+      stats.repeat[c] = 0;
+      stats.first[c] = NO_POS;
+    }
+    for (size_t i = end; i > begin; --i) {
+      unsigned char c = static_cast< unsigned char >(str[i - 1]);
+      ++stats.repeat[c];
+      stats.first[c] = i - 1;
+    }
   }
-
-  int repeat[MAX_ascii] = {};
-  for (size_t i = 0; str[i] != '\0'; ++i) {
-    unsigned char c = static_cast< unsigned char >(str[i]);
-    ++repeat[c];
+  size_t pickWorkers(size_t size)
+  {
+    if (size < 2 * karpovich::PARALLEL_THRESHOLD) {
+      return 1;
+    }
+    static const size_t cores = std::thread::hardware_concurrency();
+    size_t most = size / karpovich::PARALLEL_THRESHOLD;
+    size_t workers = cores < most ? cores : most;
+    workers = workers < karpovich::MAX_WORKERS ? workers : karpovich::MAX_WORKERS;
+    return workers == 0 ? 1 : workers;
   }
+  char* repsymSized(const char* str, size_t size, char* data, size_t workers)
+  {
+    workers = workers == 0 ? 1 : workers;
+    workers = workers < karpovich::MAX_WORKERS ? workers : karpovich::MAX_WORKERS;
+    size_t chunk = (size + workers - 1) / workers;
+    SymStats stats[karpovich::MAX_WORKERS];
+    auto scan = [str, size, chunk, &stats](size_t part)
+    {
+      size_t begin = part * chunk < size ? part * chunk : size;
+      size_t end = begin + chunk < size ? begin + chunk : size;
+      countSym(str, begin, end, stats[part]);
+    };
+    std::thread threads[karpovich::MAX_WORKERS];
+    size_t started = 1;
+    try {
+      for (; started < workers; ++started) {
+        threads[started] = std::thread(scan, started);
+      }
+    } catch (const std::exception&) {
+      for (size_t part = started; part < workers; ++part) {
+        scan(part);
+      }
+    }
+    scan(0);
+    for (size_t part = 1; part < workers; ++part) {
+      if (part < started) {
+        threads[part].join();
+      }
+      for (size_t c = 0; c < MAX_ascii; ++c) {
+        stats[0].repeat[c] += stats[part].repeat[c];
+        if (stats[part].first[c] < stats[0].first[c]) {
+          stats[0].first[c] = stats[part].first[c];
+        }
+      }
+    }
 
-  int saw[MAX_ascii] = {};
-  size_t pos = 0;
-  for (size_t i = 0; str[i] != '\0'; ++i) {
-    unsigned char c = static_cast< unsigned char >(str[i]);
-    if (repeat[c] > 1 && saw[c] == '\0') {
-      data[pos++] = c;
-      saw[c] = 1;
+    unsigned char order[MAX_ascii] = {};
+    size_t pos = 0;
+    for (size_t c = 0; c < MAX_ascii; ++c) {
+      if (stats[0].repeat[c] > 1) {
+        order[pos++] = static_cast< unsigned char >(c);
+      }
+    }
+    const size_t* first = stats[0].first;
+    std::sort(order, order + pos, [first](unsigned char a, unsigned char b)
+    {
+      return first[a] < first[b];
+    });
+    for (size_t i = 0; i < pos; ++i) {
+      data[i] = order[i];
     }
+    data[pos] = '\0';
+    return data;
   }
-  data[pos] = '\0';
-  return data;
+}
+char* karpovich::repsym(const char* str, char* data)
+{
+  if (!str || !data) {
+    return nullptr;
+  }
+  size_t size = std::strlen(str);
+  return repsymSized(str, size, data, pickWorkers(size));
+}
+char* karpovich::repsym(const char* str, char* data, size_t workers)
+{
+  if (!str || !data) {
+    return nullptr;
+  }
+  return repsymSized(str, std::strlen(str), data, workers);
 }
 char* karpovich::unitwo(const char* str1, const char* str2, size_t s1, size_t s2, char* data)
 {
   if (!str1 || !str2 || !data) {
     return nullptr;
   }
-  size_t i = 0, j = 0, k = 0;
-  while (i < s1 && j < s2) {
-    data[k++] = str1[i++];
-    data[k++] = str2[j++];
-  }
-  while (i < s1) {
-    data[k++] = str1[i++];
+  size_t common = s1 < s2 ? s1 : s2;
+  zip(str1, str2, common, data);
+  const char* rest = s1 < s2 ? str2 : str1;
+  size_t rest_size = (s1 < s2 ? s2 : s1) - common;
+  std::memcpy(data + 2 * common, rest + common, rest_size);
+  data[s1 + s2] = '\0';
+  return data;
+}
+void karpovich::zip(const char* str1, const char* str2, size_t size, char* data)
+{
+  for (size_t i = 0; i < size; ++i) {
+    data[2 * i] = str1[i];
+    data[2 * i + 1] = str2[i];
   }
-  while (j < s2) {
-    data[k++] = str2[j++];
+}
+std::ostream& karpovich::unitwo(std::istream& in1, std::istream& in2, std::ostream& out)
+{
+  char chunk1[CHUNK_SIZE];
+  char chunk2[CHUNK_SIZE];
+  char data[2 * CHUNK_SIZE + 1];
+  while (out) {
+    in1.read(chunk1, CHUNK_SIZE);
+    in2.read(chunk2, CHUNK_SIZE);
+    size_t s1 = in1.gcount();
+    size_t s2 = in2.gcount();
+    unitwo(chunk1, chunk2, s1, s2, data);
+    out.write(data, s1 + s2);
+    if (s1 != s2 || s1 < CHUNK_SIZE) {
+      std::istream& rest = s1 < s2 ? in2 : in1;
+      if (rest && rest.peek() != std::istream::traits_type::eof()) {
+        out << rest.rdbuf();
+      }
+      break;
+    }
   }
-  data[k] = '\0';
-  return data;
+  return out;
 }
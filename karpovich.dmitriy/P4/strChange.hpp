@@ -3,7 +3,13 @@
 #include <iosfwd>
 namespace karpovich
 {
+  const size_t PARALLEL_THRESHOLD = 1 << 20;
+  const size_t MAX_WORKERS = 16;
   char* repsym(const char* str, char* data);
+  char* repsym(const char* str, char* data, size_t workers);
+  const size_t CHUNK_SIZE = 4096;
   char* unitwo(const char* str1, const char* str2, size_t s1, size_t s2, char* data);
+  void zip(const char* str1, const char* str2, size_t size, char* data);
+  std::ostream& unitwo(std::istream& in1, std::istream& in2, std::ostream& out);
 }
 #endif
@@ -5,8 +5,13 @@
 namespace khalikov
 {
   void outputMtx(std::ostream & out, const int * a, size_t n, size_t m);
-  std::istream & inputMtx(std::istream & in, int * a, size_t n, size_t m);
-  size_t countSeddle(const int * a, size_t n, size_t m);
+  struct MtxSummary
+  {
+    int * rowMin;
+    int * colMax;
+  };
+  std::istream & inputMtx(std::istream & in, int * a, size_t n, size_t m, MtxSummary & sum);
+  size_t countSeddle(const int * a, const MtxSummary & sum, size_t n, size_t m);
   int * spiral(const int * a, int * res, size_t n, size_t m,
     size_t st_row, size_t st_col, size_t end_row, size_t end_col, size_t & c);
   int * spiral(const int * a, int * res, size_t n, size_t m);
@@ -25,43 +30,40 @@ void khalikov::outputMtx(std::ostream & out, const int * a, size_t n, size_t m)
   }
 }
 
-std::istream & khalikov::inputMtx(std::istream & in, int * a, size_t n, size_t m)
+std::istream & khalikov::inputMtx(std::istream & in, int * a, size_t n, size_t m, MtxSummary & sum)
 {
-  for (size_t i = 0; i < n * m; ++i)
+  for (size_t i = 0; i < n; ++i)
   {
-    if (!(in >> a[i]))
+    for (size_t j = 0; j < m; ++j)
     {
-      return in;
+      int & value = a[i * m + j];
+      if (!(in >> value))
+      {
+        return in;
+      }
+      if (j == 0 || value < sum.rowMin[i])
+      {
+        sum.rowMin[i] = value;
+      }
+      if (i == 0 || value > sum.colMax[j])
+      {
+        sum.colMax[j] = value;
+      }
     }
   }
   return in;
 }
 
-size_t khalikov::countSeddle(const int * a, size_t n, size_t m)
+size_t khalikov::countSeddle(const int * a, const MtxSummary & sum, size_t n, size_t m)
 {
-  int min = 0;
-  int max = 0;
+  const bool full = n > 1 && m > 1;
   size_t count = 0;
   for (size_t i = 0; i < n; ++i)
   {
+    int min = full ? sum.rowMin[i] : a[i * m];
     for (size_t j = 0; j < m; ++j)
     {
-      min = a[i * m];
-      max = a[j];
-      for (size_t k = 1; k < m; ++k)
-      {
-        for (size_t w = 1; w < n; ++w)
-          {
-            if (a[i * m + k] < min)
-            {
-              min = a[i * m + k];
-            }
-            if (a[w * m + j] > max)
-            {
-              max = a[w * m + j];
-            }
-          }
-      }
+      int max = full ? sum.colMax[j] : a[j];
       if (min == max)
       {
         count++;
@@ -188,7 +190,22 @@ int main(int argc, char ** argv)
       return 2;
     }
   }
-  kh::inputMtx(input, default_array, n, m);
+  kh::MtxSummary summary{nullptr, nullptr};
+  try
+  {
+    summary.rowMin = new int[n + m];
+    summary.colMax = summary.rowMin + n;
+  }
+  catch (const std::bad_alloc &)
+  {
+    std::cerr << "bad_alloc" << '\n';
+    if (*argv[1] == '2')
+    {
+      delete[] default_array;
+    }
+    return 2;
+  }
+  kh::inputMtx(input, default_array, n, m, summary);
   if (input.fail())
   {
     std::cerr << "Input error" << '\n';
@@ -196,6 +213,7 @@ int main(int argc, char ** argv)
     {
       delete[] default_array;
     }
+    delete[] summary.rowMin;
     return 2;
   }
   input.close();
@@ -211,6 +229,7 @@ int main(int argc, char ** argv)
     {
       delete[] default_array;
     }
+    delete[] summary.rowMin;
     return 2;
   }
   std::ofstream output(argv[3]);
@@ -222,9 +241,11 @@ int main(int argc, char ** argv)
       delete[] default_array;
     }
     delete[] res_array;
+    delete[] summary.rowMin;
     return 2;
   }
-  size_t result_count = kh::countSeddle(default_array, n, m);
+  size_t result_count = kh::countSeddle(default_array, summary, n, m);
+  delete[] summary.rowMin;
   res_array = kh::spiral(default_array, res_array, n, m);
   output << "the first number: " << '\n';
   output << result_count << '\n';
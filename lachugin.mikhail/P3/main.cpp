@@ -176,13 +176,6 @@ namespace lachugin
       output << ' ' << mtx[i];
     }
   }
-  void copy(int *ptr, const int *mtx, size_t r, size_t c)
-  {
-    for (size_t i = 0; i < r * c; i++)
-    {
-      ptr[i] = mtx[i];
-    }
-  }
 }
 int main(int argc, char **argv)
 {
@@ -217,25 +210,21 @@ int main(int argc, char **argv)
     return 1;
   }
   std::ofstream output(argv[3]);
-  int *res1 = nullptr;
   double *res2 = nullptr;
   int *mtx = nullptr;
   const int count = 10000;
-  int arr1[count];
   double arr2[count];
   int arr3[count];
   if (prmt == 2)
   {
     try
     {
-      res1 = new int[rows * cols];
       res2 = new double[rows * cols];
       mtx = new int[rows * cols];
     }
     catch (const std::bad_alloc &e)
     {
       std::cerr << e.what() << '\n';
-      delete[] res1;
       delete[] res2;
       delete[] mtx;
       return 3;
@@ -243,7 +232,6 @@ int main(int argc, char **argv)
   }
   else
   {
-    res1 = arr1;
     res2 = arr2;
     mtx = arr3;
   }
@@ -252,7 +240,6 @@ int main(int argc, char **argv)
   {
     if (prmt == 2)
     {
-      delete[] res1;
       delete[] res2;
       delete[] mtx;
     }
@@ -260,17 +247,15 @@ int main(int argc, char **argv)
     return 2;
   }
   fin.close();
-  lachugin::copy(res1, mtx, rows, cols);
-  lachugin::doLftBotClk(res1, rows, cols);
   lachugin::doBltSmtMtr(mtx, rows, cols, res2);
-  lachugin::outputForInt(output, rows, cols, res1);
+  lachugin::doLftBotClk(mtx, rows, cols);
+  lachugin::outputForInt(output, rows, cols, mtx);
   output << '\n';
   lachugin::outputForDouble(output, rows, cols, res2);
   output << '\n';
   output.close();
   if (prmt == 2)
     {
-    delete[] res1;
     delete[] res2;
     delete[] mtx;
   }
@@ -74,26 +74,19 @@ int main()
 
 size_t lavrentev::difLat(char* s1, char* buf1)
 {
+  const size_t word_bits = 64;
+  unsigned long long seen[256 / word_bits] = {};
   size_t answer = 0;
   size_t i = 0;
 
-  buf1[0] = '\0';
-
   while (s1[i] != '\0')
   {
-    bool flag = false;
-
-    for (size_t j = 0; j < answer; ++j)
-    {
-      if (buf1[j] == s1[i])
-      {
-        flag = true;
-        break;
-      }
-    }
+    unsigned char c = static_cast< unsigned char >(s1[i]);
+    unsigned long long mask = 1ULL << (c % word_bits);
 
-    if (!flag && std::isalpha(s1[i]))
+    if (std::isalpha(s1[i]) && !(seen[c / word_bits] & mask))
     {
+      seen[c / word_bits] |= mask;
       buf1[answer] = s1[i];
       ++answer;
     }
@@ -120,22 +113,13 @@ void lavrentev::uniTwo(char* s1, char* s2, size_t ex, size_t ex2, char* result)
     max_s_ptr = s1;
   }
 
-  size_t t = 0;
-
   for (size_t i = 0; i < min; ++i)
   {
-    result[t] =  s1[i];
-    result[t + 1] =  s2[i];
-    t += 2;
+    result[2 * i] = s1[i];
+    result[2 * i + 1] = s2[i];
   }
 
-  t = min;
-
-  for (size_t i = min * 2; i < ex + ex2; ++i)
-  {
-    result[i] = max_s_ptr[t];
-    ++t;
-  }
+  std::memcpy(result + min * 2, max_s_ptr + min, ex + ex2 - min * 2);
   result[ex + ex2] = '\0';
 }
 
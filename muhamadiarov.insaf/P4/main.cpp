@@ -4,17 +4,7 @@
 
 namespace muhamadiarov
 {
-  bool checkOnRepeat(const char *line, char symbol, size_t size)
-  {
-    for (size_t i = 0; i < size; ++i)
-    {
-      if (line[i] == symbol)
-      {
-        return true;
-      }
-    }
-    return false;
-  }
+  const size_t charsetSize = 256;
   char *getline(std::istream &in, size_t &size)
   {
     bool is_skipws = in.flags() & std::ios_base::skipws;
@@ -72,53 +62,53 @@ namespace muhamadiarov
   }
   char *latRmv(char *res, const char *str)
   {
-    size_t i = 0;
+    bool keep[charsetSize];
+    for (size_t c = 0; c < charsetSize; ++c)
+    {
+      keep[c] = !std::isalpha(c);
+    }
     size_t count = 0;
-    while (str[i] != '\0')
+    for (size_t i = 0; str[i] != '\0'; ++i)
     {
-      if (!std::isalpha(str[i]))
-      {
-        res[count++] = str[i];
-      }
-      ++i;
+      res[count] = str[i];
+      count += keep[static_cast< unsigned char >(str[i])];
     }
     res[count] = '\0';
     return res;
   }
-  char *toAssociatStrings(const char *str1, char *res, size_t &size)
+  void markLetters(const char *line, bool *seen)
   {
-    size_t i = 0;
-    while (str1[i] != '\0')
+    for (size_t i = 0; line[i] != '\0'; ++i)
     {
-      bool ch = checkOnRepeat(res, str1[i], size);
-      if (std::isalpha(str1[i]) && str1[i] != ' ' && !ch)
+      unsigned char c = static_cast< unsigned char >(line[i]);
+      if (std::isalpha(c))
       {
-        res[size++] = str1[i];
+        seen[c] = true;
       }
-      ++i;
     }
-    return res;
   }
-  char *latTwo(const char *line1, const char *line2, char *res2)
+  char *sortedLetters(const char * const *lines, size_t count, char *res)
   {
+    bool seen[charsetSize] = {};
+    for (size_t i = 0; i < count; ++i)
+    {
+      markLetters(lines[i], seen);
+    }
     size_t size = 0;
-    res2 = toAssociatStrings(line1, res2, size);
-    res2 = toAssociatStrings(line2, res2, size);
-    char tch = ' ';
-    for (size_t i = 0; i < size; ++i)
+    for (size_t c = 0; c < charsetSize; ++c)
     {
-      for (size_t j = 0; j < size - i - 1; ++j)
+      if (seen[c])
       {
-        if (res2[j] > res2[j + 1])
-        {
-          tch = res2[j];
-          res2[j] = res2[j + 1];
-          res2[j + 1] = tch;
-        }
+        res[size++] = static_cast< char >(c);
       }
     }
-    res2[size] = '\0';
-    return res2;
+    res[size] = '\0';
+    return res;
+  }
+  char *latTwo(const char *line1, const char *line2, char *res2)
+  {
+    const char *lines[] = {line1, line2};
+    return sortedLetters(lines, 2, res2);
   }
 }
 
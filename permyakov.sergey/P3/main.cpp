@@ -5,7 +5,7 @@
 namespace permyakov
 {
   void lftTopClk(int * arr1, int * arr, size_t n, size_t m);
-  void lftBotCnt(int * arr2, int * arr, size_t n, size_t m);
+  void lftBotCnt(int * arr, size_t n, size_t m);
   std::ifstream & arrInFromFile(std::ifstream & in, int * arr, size_t n, size_t m);
   std::ofstream & arrOutInFile(std::ofstream & out, const int * arr, size_t n, size_t m);
 }
@@ -58,25 +58,21 @@ int main(int argc, char ** argv)
     free(arrD);
     return 2;
   }
-  int * arr1 = reinterpret_cast< int * >(malloc(sizeof(int) * n * m));;
-  int * arr2 = reinterpret_cast< int * >(malloc(sizeof(int) * n * m));
-  if (arr1 == nullptr || arr2 == nullptr) {
+  int * arr1 = reinterpret_cast< int * >(malloc(sizeof(int) * n * m));
+  if (arr1 == nullptr) {
     std::cerr << "Failure to allocate memory\n";
-    free(arr1);
-    free(arr2);
     free(arrD);
     return 3;
   }
   per::lftTopClk(arr1, arr, n, m);
-  per::lftBotCnt(arr2, arr, n, m);
+  per::lftBotCnt(arr, n, m);
 
   std::ofstream output(argv[3]);
   per::arrOutInFile(output, arr1, n, m);
   output << '\n';
-  per::arrOutInFile(output, arr2, n, m);
+  per::arrOutInFile(output, arr, n, m);
   output << '\n';
   free(arr1);
-  free(arr2);
   free(arrD);
 }
 
@@ -121,43 +117,40 @@ void permyakov::lftTopClk(int * arr1, int * arr, size_t n, size_t m)
   }
 }
 
-void permyakov::lftBotCnt(int * arr2, int * arr, size_t n, size_t m)
+void permyakov::lftBotCnt(int * arr, size_t n, size_t m)
 {
   if (n * m == 0) {
     return;
   }
-  for (size_t i = 0; i < n * m; ++i) {
-    arr2[i] = arr[i];
-  }
   size_t lef = 0, rig = m - 1, top = 0, bot = n - 1;
   size_t cnt = 1, i = n - 1, j = 0;
   while (cnt < n * m) {
     while (j < rig) {
-      arr2[i * m + j] += cnt;
+      arr[i * m + j] += cnt;
       cnt++;
       j++;
     }
     bot--;
     while (i > top) {
-      arr2[i * m + j] += cnt;
+      arr[i * m + j] += cnt;
       cnt++;
       i--;
     }
     rig--;
     while (j > lef) {
-      arr2[i * m + j] += cnt;
+      arr[i * m + j] += cnt;
       cnt++;
       j--;
     }
     top++;
     while (i < bot) {
-      arr2[i * m + j] += cnt;
+      arr[i * m + j] += cnt;
       cnt++;
       i++;
     }
     lef++;
     if (cnt == n * m) {
-      arr2[i * m + j] += cnt;
+      arr[i * m + j] += cnt;
     }
   }
 }
@@ -42,47 +42,102 @@ namespace petrov {
     }
     return resStr;
   }
-  void duplicateForUncSym(const char* str1, const char* str2, char* result, size_t& place)
+  const size_t charset_size = 256;
+
+  void markChars(const char* str, bool* marks)
+  {
+    for (size_t i = 0; str[i] != '\0'; ++i) {
+      marks[static_cast< unsigned char >(str[i])] = true;
+    }
+  }
+
+  void duplicateForUncSym(const char* str1, const bool* in_str2, bool* seen, char* result, size_t& place)
   {
     for (size_t i = 0; str1[i] != '\0'; ++i) {
-      bool flag1 = false;
-      for (size_t j = 0; str2[j] != '\0'; ++j) {
-        if (str1[i] == str2[j]) {
-          flag1 = true;
-          break;
-        }
-      }
-      if (!flag1) {
-        bool flag2 = false;
-        for (size_t k = 0; k < place; ++k) {
-          if (result[k] == str1[i]) {
-            flag2 = true;
-            break;
-          }
-        }
-        if (!flag2) {
-          result[place++] = str1[i];
-        }
+      unsigned char c = static_cast< unsigned char >(str1[i]);
+      if (!in_str2[c] && !seen[c]) {
+        seen[c] = true;
+        result[place++] = str1[i];
       }
     }
   }
 
+  void doDifSym(const char* str1, const char* str2, char* result)
+  {
+    bool in_str2[charset_size] = {};
+    bool seen[charset_size] = {};
+    markChars(str2, in_str2);
+    size_t place = 0;
+    duplicateForUncSym(str1, in_str2, seen, result, place);
+    result[place] = '\0';
+  }
+
   void doUncSym(const char* str1, const char* str2, char* result)
   {
+    bool in_str1[charset_size] = {};
+    bool in_str2[charset_size] = {};
+    bool seen[charset_size] = {};
+    markChars(str1, in_str1);
+    markChars(str2, in_str2);
     size_t place = 0;
-    duplicateForUncSym(str1, str2, result, place);
-    duplicateForUncSym(str2, str1, result, place);
+    duplicateForUncSym(str1, in_str2, seen, result, place);
+    duplicateForUncSym(str2, in_str1, seen, result, place);
     result[place] = '\0';
   }
 
-  size_t doSeqSym(const char* str)
+  const size_t word_size = sizeof(unsigned long long);
+  const unsigned long long low_bytes = 0x0101010101010101ULL;
+  const unsigned long long high_bits = 0x8080808080808080ULL;
+
+  bool hasZeroByte(unsigned long long word)
   {
-    for (size_t i = 1; str[i] != '\0'; ++i) {
+    return (word - low_bytes) & ~word & high_bits;
+  }
+
+  size_t findSeqSym(const char* str, size_t len, bool stopAtNul)
+  {
+    size_t i = 1;
+    for (; i + word_size <= len; i += word_size) {
+      unsigned long long cur = 0;
+      unsigned long long prev = 0;
+      std::memcpy(&cur, str + i, word_size);
+      std::memcpy(&prev, str + i - 1, word_size);
+      if ((stopAtNul && hasZeroByte(prev)) || hasZeroByte(cur ^ prev)) {
+        break;
+      }
+    }
+    for (; i < len && !(stopAtNul && str[i - 1] == '\0'); ++i) {
       if (str[i] == str[i - 1]) {
-        return 1;
+        return i;
+      }
+    }
+    return len;
+  }
+
+  size_t doSeqRuns(const char* str, size_t len, size_t* bounds)
+  {
+    size_t count = 0;
+    size_t from = 0;
+    while (from < len) {
+      size_t pos = from + findSeqSym(str + from, len - from, false);
+      if (pos == len) {
+        break;
+      }
+      size_t end = pos + 1;
+      while (end < len && str[end] == str[pos]) {
+        ++end;
       }
+      bounds[2 * count] = pos - 1;
+      bounds[2 * count + 1] = end;
+      ++count;
+      from = end;
     }
-    return 0;
+    return count;
+  }
+
+  size_t doSeqSym(const char* str, size_t len)
+  {
+    return findSeqSym(str, len, true) != len ? 1 : 0;
   }
 }
 
@@ -106,7 +161,7 @@ int main()
   }
   ansUncSym[len + sec_len] = '\0';
   petrov::doUncSym(str, sec_str, ansUncSym);
-  size_t ansSeqSym = petrov::doSeqSym(str);
+  size_t ansSeqSym = petrov::doSeqSym(str, len);
   std::cout << ansUncSym << '\n';
   std::cout << ansSeqSym << '\n';
   free(str);
@@ -1,55 +1,68 @@
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <sys/stat.h>
 
 namespace saldaev
 {
   const size_t block_size = 10;
+  const size_t charset_size = 256;
+  const size_t max_hint = 1 << 24;
 
-  char *getLine(std::istream &in, size_t &len, const size_t block_size = block_size)
+  size_t sizeHint(int fd)
   {
-    char *data = reinterpret_cast< char * >(malloc((block_size + 1) * sizeof(char)));
+    struct stat info{};
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0) {
+      return block_size;
+    }
+    size_t size = info.st_size;
+    return size < max_hint ? size : max_hint;
+  }
+
+  char *getLine(std::istream &in, size_t &len, size_t capacity = block_size)
+  {
+    capacity = capacity < block_size ? block_size : capacity;
+    char *data = reinterpret_cast< char * >(malloc((capacity + 1) * sizeof(char)));
     if (data == nullptr) {
       return nullptr;
     }
-    bool skipws_on = in.flags() & std::ios_base::skipws;
-    if (skipws_on) {
-      in >> std::noskipws;
-    }
 
-    size_t capacity = block_size;
     len = 0;
-    char crnt_char = ' ';
-    while (in >> crnt_char && crnt_char != '\r' && crnt_char != '\n') {
-      len++;
-      if (len > capacity) {
-        char *tmp = reinterpret_cast< char * >(malloc((capacity + block_size + 1) * sizeof(char)));
+    while (true) {
+      if (len == capacity) {
+        char *tmp = reinterpret_cast< char * >(realloc(data, (capacity * 2 + 1) * sizeof(char)));
         if (tmp == nullptr) {
           free(data);
-          if (skipws_on) {
-            in >> std::skipws;
-          }
           return nullptr;
         }
-        capacity += block_size;
-        for (size_t i = 0; i < len - 1; ++i) {
-          tmp[i] = data[i];
-        }
-        free(data);
+        capacity *= 2;
         data = tmp;
       }
-      data[len - 1] = crnt_char;
-    }
-    if (skipws_on) {
-      in >> std::skipws;
+      in.getline(data + len, capacity - len + 1);
+      size_t count = in.gcount();
+      if (in.eof()) {
+        len += count;
+        break;
+      }
+      if (!in.fail()) {
+        len += count - 1;
+        break;
+      }
+      if (count == 0) {
+        free(data);
+        return nullptr;
+      }
+      len += count;
+      in.clear(in.rdstate() & ~std::ios_base::failbit);
     }
-    if (crnt_char == '\r' || crnt_char == '\n' || in.eof()) {
-      data[len] = '\0';
-      return data;
+    const char *cr = reinterpret_cast< const char * >(std::memchr(data, '\r', len));
+    if (cr != nullptr) {
+      len = cr - data;
     }
-    free(data);
-    return nullptr;
+    data[len] = '\0';
+    return data;
   }
 
   char *spcRmv(const char *data, char *new_arr)
@@ -79,16 +92,14 @@ namespace saldaev
     if (new_arr == nullptr) {
       return nullptr;
     }
+    bool keep[charset_size];
+    for (size_t c = 0; c < charset_size; ++c) {
+      keep[c] = !std::isalpha(c);
+    }
     size_t crnt_digit = 0;
-    size_t i = 0;
-    char crnt_char = data[i];
-    while (crnt_char != '\0') {
-      if (!std::isalpha(crnt_char)) {
-        new_arr[crnt_digit] = crnt_char;
-        crnt_digit++;
-      }
-      i++;
-      crnt_char = data[i];
+    for (size_t i = 0; data[i] != '\0'; ++i) {
+      new_arr[crnt_digit] = data[i];
+      crnt_digit += keep[static_cast< unsigned char >(data[i])];
     }
     new_arr[crnt_digit] = '\0';
     return new_arr;
@@ -98,7 +109,7 @@ namespace saldaev
 int main()
 {
   size_t len = 0;
-  char *line = saldaev::getLine(std::cin, len);
+  char *line = saldaev::getLine(std::cin, len, saldaev::sizeHint(0));
   if (line == nullptr) {
     std::cerr << "Could not read the string\n";
     return 1;
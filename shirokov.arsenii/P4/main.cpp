@@ -10,6 +10,8 @@ namespace shirokov
   size_t LATIN_ALPHABET_LENGTH = 26;
   const int CASE_DELTA = 32;
   const char LITERAL[] = "def ";
+  const size_t WORD_BITS = 64;
+  const size_t CHARSET_WORDS = 256 / WORD_BITS;
   char *uniq(char *res, const char *str, size_t &rsize);
   void expand(char **str, size_t size, size_t &capacity);
   char *getline(std::istream &in, size_t &s);
@@ -113,19 +115,17 @@ char *shirokov::otherLatinLetters(const char *str, char *res, char *buffer)
 {
   size_t rsize = 0;
   buffer = uniq(buffer, str, rsize);
+  unsigned long long seen[CHARSET_WORDS] = {};
+  for (size_t i = 0; i < rsize; ++i)
+  {
+    unsigned char c = static_cast< unsigned char >(buffer[i]);
+    seen[c / WORD_BITS] |= 1ULL << (c % WORD_BITS);
+  }
   size_t pos = 0;
   for (char letter = 'a'; letter <= 'z'; ++letter)
   {
-    bool in_str = false;
-    for (size_t i = 0; i < rsize; ++i)
-    {
-      if (buffer[i] == letter)
-      {
-        in_str = true;
-        break;
-      }
-    }
-    if (!in_str)
+    unsigned char c = static_cast< unsigned char >(letter);
+    if (!(seen[c / WORD_BITS] & (1ULL << (c % WORD_BITS))))
     {
       res[pos++] = letter;
     }
@@ -143,33 +143,26 @@ char *shirokov::combineLines(const char *str1, size_t s1, const char *str2, size
     res[2 * i + 1] = str2[i];
   }
   const char *maxString = s1 > s2 ? str1 : str2;
-  for (size_t i = minn * 2; i < s1 + s2; ++i)
-  {
-    res[i] = maxString[i - minn];
-  }
+  std::memcpy(res + minn * 2, maxString + minn, s1 + s2 - minn * 2);
   return res;
 }
 
 char *shirokov::uniq(char *res, const char *str, size_t &rsize)
 {
   rsize = 0;
+  unsigned long long seen[CHARSET_WORDS] = {};
   for (size_t i = 0; str[i] != '\0'; ++i)
   {
-    bool in_res = false;
     char temp = str[i];
     if ('A' <= temp && temp <= 'Z')
     {
       temp += shirokov::CASE_DELTA;
     }
-    for (size_t j = 0; j < rsize; ++j)
-    {
-      if (temp == res[j])
-      {
-        in_res = true;
-      }
-    }
-    if (!in_res)
+    unsigned char c = static_cast< unsigned char >(temp);
+    unsigned long long mask = 1ULL << (c % WORD_BITS);
+    if (!(seen[c / WORD_BITS] & mask))
     {
+      seen[c / WORD_BITS] |= mask;
       res[rsize++] = temp;
     }
   }
@@ -3,48 +3,34 @@
 #include <cstdlib>
 namespace sogdanov
 {
-  std::istream & readMatrix(std::ifstream & input, int * mtx, size_t rows, size_t cols)
+  std::istream & readMatrix(std::ifstream & input, int * mtx, size_t rows, size_t cols, int * rowMin, int * colMax)
   {
-    for (size_t i = 0; i < rows * cols ; i++) {
-      if (!(input >> mtx[i])) {
-        return input;
+    for (size_t i = 0; i < rows; ++i) {
+      for (size_t j = 0; j < cols; ++j) {
+        int & value = mtx[i * cols + j];
+        if (!(input >> value)) {
+          return input;
+        }
+        if (j == 0 || value < rowMin[i]) {
+          rowMin[i] = value;
+        }
+        if (i == 0 || value > colMax[j]) {
+          colMax[j] = value;
+        }
       }
     }
     return input;
   }
-  int cntSdlPnt(const int * mtx, size_t rows, size_t cols)
+  int cntSdlPnt(const int * mtx, size_t rows, size_t cols, const int * rowMin, const int * colMax)
   {
-    if (rows == 0 || cols == 0) {
-      return 0;
-    }
-    int * rowMin = reinterpret_cast< int * >(malloc(rows * sizeof(int)));
-    if (rowMin == nullptr) {
-      return -1;
-    }
-    for (size_t i = 0; i < rows; ++i) {
-      int minValue = mtx[i * cols];
-      for (size_t j = 1; j < cols; ++j) {
-        if (mtx[i * cols + j] < minValue) {
-          minValue = mtx[i * cols +j];
-        }
-      }
-      rowMin[i] = minValue;
-    }
     size_t count = 0;
-    for (size_t i = 0; i < cols; ++i) {
-      int maxVal = mtx[i];
-      for (size_t j = 1; j < rows; ++j) {
-        if (mtx[j * cols + i] > maxVal) {
-          maxVal = mtx[j * cols + i];
-        }
-      }
-      for (size_t j = 0; j < rows; ++j) {
-        if (mtx[j * cols + i] == maxVal && mtx[j * cols + i] == rowMin[j]) {
+    for (size_t i = 0; i < rows; ++i) {
+      for (size_t j = 0; j < cols; ++j) {
+        if (mtx[i * cols + j] == colMax[j] && mtx[i * cols + j] == rowMin[i]) {
           count++;
         }
       }
     }
-    free(rowMin);
     return count;
   }
   int maxSumSdg(const int * mtx, size_t rows, size_t cols)
@@ -134,25 +120,29 @@ int main(int argc, char ** argv)
     std::cerr << "Memory allocation failed\n";
     return 2;
   }
-  sogdanov::readMatrix(input, mtx, rows, cols);
+  int * summary = reinterpret_cast< int * >(malloc((rows + cols) * sizeof(int)));
+  if (summary == nullptr && rows + cols != 0) {
+    std::cerr << "Memory allocation failed\n";
+    sogdanov::rm(num, mtx);
+    return 2;
+  }
+  sogdanov::readMatrix(input, mtx, rows, cols, summary, summary + rows);
   if (input.fail()) {
     std::cerr << "Input error\n";
+    free(summary);
     sogdanov::rm(num, mtx);
     return 2;
   }
   int extra;
   if (input >> extra) {
     std::cerr << "Too many elements in input file\n";
+    free(summary);
     sogdanov::rm(num, mtx);
     return 2;
   }
   int res1 = sogdanov::maxSumSdg(mtx, rows, cols);
-  int res2 = sogdanov::cntSdlPnt(mtx, rows, cols);
-  if (res2 < 0) {
-    std::cerr << "Memory allocation failed\n";
-    sogdanov::rm(num,mtx);
-    return 2;
-  }
+  int res2 = sogdanov::cntSdlPnt(mtx, rows, cols, summary, summary + rows);
+  free(summary);
   sogdanov::rm(num, mtx);
   std::ofstream output(argv[3]);
   if (!output) {
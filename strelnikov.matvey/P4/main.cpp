@@ -1,59 +1,64 @@
 #include <iostream>
 #include <cctype>
+#include <cstring>
 
 namespace strelnikov {
 
   using std::free;
-  char* addSymb(const char* str, size_t& s, char ch)
-  {
-    char* tmp = reinterpret_cast< char* >(malloc(s + 2));
-    if (!tmp) {
-      return nullptr;
-    }
+  const size_t init_capacity = 16;
 
-    for (size_t i = 0; i < s; ++i) {
-      tmp[i] = str[i];
+  char* extend(char* str, size_t s, size_t& capacity)
+  {
+    char* tmp = reinterpret_cast< char* >(malloc(capacity * 2));
+    if (tmp) {
+      std::memcpy(tmp, str, s);
+      capacity *= 2;
     }
-
-    tmp[s] = ch;
-    tmp[s + 1] = '\0';
-
-    ++s;
+    free(str);
     return tmp;
   }
 
   char* getString(std::istream& in, size_t& s)
   {
-    bool isSkipWp = in.flags() & std::ios::skipws;
-    if (isSkipWp) {
-      in >> std::noskipws;
-    }
-    char* res = nullptr;
+    size_t capacity = init_capacity;
+    char* res = reinterpret_cast< char* >(malloc(capacity));
     s = 0;
+    if (!res) {
+      return nullptr;
+    }
 
-    char ch;
-    while (in >> ch && ch != '\n') {
-      char* tmp = addSymb(res, s, ch);
-      free(res);
-      if (!tmp) {
-        if (isSkipWp) {
-          in >> std::skipws;
+    while (true) {
+      if (capacity - s < 2) {
+        res = extend(res, s, capacity);
+        if (!res) {
+          s = 0;
+          return nullptr;
         }
+      }
+      in.getline(res + s, capacity - s);
+      size_t count = in.gcount();
+      if (in.eof()) {
+        s += count;
+        break;
+      }
+      if (!in.fail()) {
+        s += count - 1;
+        break;
+      }
+      if (count == 0) {
+        free(res);
+        s = 0;
         return nullptr;
       }
-      res = tmp;
+      s += count;
+      in.clear(in.rdstate() & ~std::ios::failbit);
     }
 
-    if (in.fail() && !in.eof()) {
+    if (s == 0) {
       free(res);
-      if (isSkipWp) {
-        in >> std::skipws;
-      }
       return nullptr;
     }
-    if (isSkipWp) {
-      in >> std::skipws;
-    }
+    res[s] = '\0';
     return res;
   }
 
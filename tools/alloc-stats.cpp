@@ -0,0 +1,235 @@
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <fcntl.h>
+#include <malloc.h>
+#include <unistd.h>
+
+extern "C"
+{
+  void *__libc_malloc(size_t size);
+  void *__libc_calloc(size_t count, size_t size);
+  void *__libc_realloc(void *ptr, size_t size);
+  void *__libc_memalign(size_t alignment, size_t size);
+  void *__libc_valloc(size_t size);
+  void *__libc_pvalloc(size_t size);
+  void __libc_free(void *ptr);
+}
+
+namespace
+{
+  enum Kind
+  {
+    MALLOC,
+    CALLOC,
+    REALLOC,
+    MEMALIGN,
+    FREE,
+    NEW,
+    DELETE,
+    KIND_COUNT
+  };
+  const char *const kindNames[KIND_COUNT] = {"malloc", "calloc", "realloc", "memalign", "free", "new", "delete"};
+  const size_t minBucketBits = 4;
+  const size_t bucketCount = 18;
+
+  std::atomic< unsigned long > calls[KIND_COUNT];
+  std::atomic< unsigned long > bytes[KIND_COUNT];
+  std::atomic< unsigned long > histogram[bucketCount];
+  std::atomic< unsigned long > live;
+  std::atomic< unsigned long > peak;
+
+  size_t bucketOf(size_t size) noexcept
+  {
+    size_t bucket = 0;
+    while (bucket + 1 < bucketCount && size > (size_t(1) << (bucket + minBucketBits))) {
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  void addLive(size_t size) noexcept
+  {
+    unsigned long now = live += size;
+    unsigned long top = peak.load();
+    while (now > top && !peak.compare_exchange_weak(top, now)) {
+    }
+  }
+
+  void subLive(size_t size) noexcept
+  {
+    unsigned long now = live.load();
+    while (!live.compare_exchange_weak(now, now > size ? now - size : 0)) {
+    }
+  }
+
+  void *noteAlloc(Kind kind, void *ptr, size_t size, size_t requested) noexcept
+  {
+    ++calls[kind];
+    bytes[kind] += requested;
+    ++histogram[bucketOf(size)];
+    if (ptr != nullptr) {
+      addLive(malloc_usable_size(ptr));
+    }
+    return ptr;
+  }
+
+  void noteFree(Kind kind, void *ptr) noexcept
+  {
+    if (ptr == nullptr) {
+      return;
+    }
+    ++calls[kind];
+    size_t size = malloc_usable_size(ptr);
+    bytes[kind] += size;
+    subLive(size);
+    __libc_free(ptr);
+  }
+
+  void *newBlock(Kind kind, size_t size) noexcept
+  {
+    return noteAlloc(kind, __libc_malloc(size == 0 ? 1 : size), size, size);
+  }
+
+  void printLine(int fd, const char *line, int length) noexcept
+  {
+    if (length > 0 && write(fd, line, length) < 0) {
+      return;
+    }
+  }
+
+  __attribute__((destructor)) void printSummary() noexcept
+  {
+    const char *path = std::getenv("ALLOC_STATS_OUT");
+    int fd = path ? open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600) : STDERR_FILENO;
+    if (fd < 0) {
+      return;
+    }
+    unsigned long allocations = calls[MALLOC] + calls[CALLOC] + calls[REALLOC] + calls[MEMALIGN] + calls[NEW];
+    unsigned long frees = calls[FREE] + calls[DELETE];
+    unsigned long allocated = bytes[MALLOC] + bytes[CALLOC] + bytes[REALLOC] + bytes[MEMALIGN] + bytes[NEW];
+    char line[160];
+    printLine(fd, line, std::snprintf(line, sizeof(line),
+      "alloc-stats: %lu allocations, %lu frees, %lu bytes requested, %lu bytes peak live\n",
+      allocations, frees, allocated, peak.load()));
+    for (size_t i = 0; i < KIND_COUNT; ++i) {
+      printLine(fd, line, std::snprintf(line, sizeof(line), "  %-8s %12lu calls %16lu bytes\n",
+        kindNames[i], calls[i].load(), bytes[i].load()));
+    }
+    for (size_t i = 0; i < bucketCount; ++i) {
+      const char *prefix = (i + 1 == bucketCount) ? ">" : "<=";
+      size_t bound = size_t(1) << (i + minBucketBits - (i + 1 == bucketCount));
+      printLine(fd, line, std::snprintf(line, sizeof(line), "  %2s %-9zu %12lu\n", prefix, bound, histogram[i].load()));
+    }
+    if (path) {
+      close(fd);
+    }
+  }
+}
+
+extern "C" void *malloc(size_t size) noexcept
+{
+  return noteAlloc(MALLOC, __libc_malloc(size), size, size);
+}
+extern "C" void *calloc(size_t count, size_t size) noexcept
+{
+  return noteAlloc(CALLOC, __libc_calloc(count, size), count * size, count * size);
+}
+extern "C" void *realloc(void *ptr, size_t size) noexcept
+{
+  size_t old = ptr ? malloc_usable_size(ptr) : 0;
+  void *result = __libc_realloc(ptr, size);
+  if (result != nullptr || size == 0) {
+    subLive(old);
+  }
+  return noteAlloc(REALLOC, result, size, size > old ? size - old : 0);
+}
+extern "C" void *reallocarray(void *ptr, size_t count, size_t size) noexcept
+{
+  if (size != 0 && count > SIZE_MAX / size) {
+    errno = ENOMEM;
+    return nullptr;
+  }
+  return realloc(ptr, count * size);
+}
+extern "C" void *memalign(size_t alignment, size_t size) noexcept
+{
+  return noteAlloc(MEMALIGN, __libc_memalign(alignment, size), size, size);
+}
+extern "C" void *aligned_alloc(size_t alignment, size_t size) noexcept
+{
+  return noteAlloc(MEMALIGN, __libc_memalign(alignment, size), size, size);
+}
+extern "C" int posix_memalign(void **out, size_t alignment, size_t size) noexcept
+{
+  if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0 || alignment == 0) {
+    return EINVAL;
+  }
+  void *ptr = noteAlloc(MEMALIGN, __libc_memalign(alignment, size), size, size);
+  if (ptr == nullptr) {
+    return ENOMEM;
+  }
+  *out = ptr;
+  return 0;
+}
+extern "C" void *valloc(size_t size) noexcept
+{
+  return noteAlloc(MEMALIGN, __libc_valloc(size), size, size);
+}
+extern "C" void *pvalloc(size_t size) noexcept
+{
+  return noteAlloc(MEMALIGN, __libc_pvalloc(size), size, size);
+}
+extern "C" void free(void *ptr) noexcept
+{
+  noteFree(FREE, ptr);
+}
+
+void *operator new(size_t size)
+{
+  void *ptr = newBlock(NEW, size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+  return newBlock(NEW, size);
+}
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+  return newBlock(NEW, size);
+}
+void operator delete(void *ptr) noexcept
+{
+  noteFree(DELETE, ptr);
+}
+void operator delete[](void *ptr) noexcept
+{
+  noteFree(DELETE, ptr);
+}
+void operator delete(void *ptr, size_t) noexcept
+{
+  noteFree(DELETE, ptr);
+}
+void operator delete[](void *ptr, size_t) noexcept
+{
+  noteFree(DELETE, ptr);
+}
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+  noteFree(DELETE, ptr);
+}
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+  noteFree(DELETE, ptr);
+}
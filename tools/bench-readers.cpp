@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+  struct Case
+  {
+    const char *name;
+    size_t length;
+    const char *ending;
+    size_t repeats;
+    bool perRun;
+  };
+  // Every run times the whole lab: start-up, reading and its own kernels.
+  // Per-run cases subtract a paired run on a one-character line.
+  const Case startup = {"one", 1, "\n", 200, true};
+  const Case cases[] = {
+    {"short", 60, "\n", 200, true},
+    {"1mb", 1 << 20, "\n", 3, false},
+    {"no-eol", 1 << 16, "", 10, false},
+    {"crlf", 1 << 16, "\r\n", 10, false}
+  };
+  const size_t caseCount = sizeof(cases) / sizeof(cases[0]);
+
+  struct Result
+  {
+    double seconds;
+    long peakKb;
+    unsigned long allocations;
+    const char *error;
+  };
+
+  std::string makeInput(const Case &c)
+  {
+    const char alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789  .,";
+    const size_t alphabetSize = sizeof(alphabet) - 1;
+    std::string input(c.length, ' ');
+    unsigned long long state = 0x2545f4914f6cdd1dULL;
+    for (size_t i = 0; i < c.length; ++i) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      input[i] = alphabet[(state >> 33) % alphabetSize];
+    }
+    return input + c.ending;
+  }
+
+  bool writeAll(int fd, const std::string &input)
+  {
+    size_t done = 0;
+    while (done < input.size()) {
+      ssize_t count = write(fd, input.data() + done, input.size() - done);
+      if (count <= 0) {
+        return false;
+      }
+      done += count;
+    }
+    return true;
+  }
+
+  double now()
+  {
+    timeval tv{};
+    gettimeofday(&tv, nullptr);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+  }
+
+  unsigned long readAllocations(const std::string &stats)
+  {
+    unsigned long allocations = 0;
+    std::FILE *file = std::fopen(stats.c_str(), "r");
+    if (file != nullptr) {
+      if (std::fscanf(file, "alloc-stats: %lu", &allocations) != 1) {
+        allocations = 0;
+      }
+      std::fclose(file);
+    }
+    return allocations;
+  }
+
+  Result runOnce(const char *lab, const std::string &input, const char *preload, const std::string &stats, unsigned timeout)
+  {
+    int channel[2] = {-1, -1};
+    if (pipe(channel) < 0) {
+      return Result{0.0, 0, 0, "failed"};
+    }
+    double start = now();
+    pid_t pid = fork();
+    if (pid < 0) {
+      close(channel[0]);
+      close(channel[1]);
+      return Result{0.0, 0, 0, "failed"};
+    }
+    if (pid == 0) {
+      int null = open("/dev/null", O_WRONLY);
+      if (null < 0) {
+        _exit(127);
+      }
+      close(channel[1]);
+      dup2(channel[0], STDIN_FILENO);
+      dup2(null, STDOUT_FILENO);
+      dup2(null, STDERR_FILENO);
+      if (preload != nullptr) {
+        setenv("LD_PRELOAD", preload, 1);
+        setenv("ALLOC_STATS_OUT", stats.c_str(), 1);
+      }
+      alarm(timeout);
+      execl(lab, lab, static_cast< char * >(nullptr));
+      _exit(127);
+    }
+    close(channel[0]);
+    writeAll(channel[1], input);
+    close(channel[1]);
+    int status = 0;
+    rusage usage{};
+    if (wait4(pid, &status, 0, &usage) < 0) {
+      return Result{0.0, 0, 0, "failed"};
+    }
+    const char *error = nullptr;
+    if (WIFSIGNALED(status)) {
+      error = WTERMSIG(status) == SIGALRM ? "timeout" : "crashed";
+    } else if (WEXITSTATUS(status) != 0) {
+      error = "failed";
+    }
+    double seconds = now() - start;
+    unsigned long allocations = preload != nullptr ? readAllocations(stats) : 0;
+    return Result{seconds, usage.ru_maxrss, allocations, error};
+  }
+
+  Result runCase(const char *lab, const std::string &input, const std::string *baseline, size_t repeats,
+    const char *preload, const std::string &stats, unsigned timeout)
+  {
+    Result total{0.0, 0, 0, nullptr};
+    std::vector< double > samples;
+    for (size_t r = 0; total.error == nullptr && r < repeats; ++r) {
+      double offset = 0.0;
+      if (baseline != nullptr) {
+        Result base = runOnce(lab, *baseline, preload, stats, timeout);
+        total.error = base.error;
+        offset = base.seconds;
+      }
+      Result result = runOnce(lab, input, preload, stats, timeout);
+      total.error = total.error ? total.error : result.error;
+      total.allocations = result.allocations;
+      total.peakKb = result.peakKb > total.peakKb ? result.peakKb : total.peakKb;
+      samples.push_back(result.seconds > offset ? result.seconds - offset : 0.0);
+    }
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    total.seconds = samples[samples.size() / 2];
+    return total;
+  }
+
+  std::string labName(const char *lab)
+  {
+    std::string path(lab);
+    size_t from = path.compare(0, 4, "out/") == 0 ? 4 : 0;
+    return path.substr(from, path.find('/', from) - from);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  unsigned timeout = 10;
+  const char *preload = nullptr;
+  int first = 1;
+  while (first + 1 < argc && argv[first][0] == '-') {
+    if (std::strcmp(argv[first], "-t") == 0) {
+      timeout = std::strtoul(argv[first + 1], nullptr, 10);
+    } else if (std::strcmp(argv[first], "-p") == 0) {
+      preload = argv[first + 1];
+    } else {
+      break;
+    }
+    first += 2;
+  }
+  if (first >= argc || timeout == 0) {
+    std::cerr << "Usage: " << argv[0] << " [-t seconds] [-p alloc-stats.so] lab...\n";
+    return 1;
+  }
+  char dir[] = "/tmp/bench-readers-XXXXXX";
+  if (mkdtemp(dir) == nullptr) {
+    std::cerr << "Cannot create stats directory\n";
+    return 1;
+  }
+  std::string stats = std::string(dir) + "/stats";
+  std::string one = makeInput(startup);
+  std::string inputs[caseCount];
+  for (size_t i = 0; i < caseCount; ++i) {
+    inputs[i] = makeInput(cases[i]);
+  }
+  std::signal(SIGPIPE, SIG_IGN);
+  std::cout << std::left << std::setw(20) << "reader";
+  for (size_t i = 0; i < caseCount; ++i) {
+    std::cout << std::right << std::setw(12) << std::string(cases[i].name) + (cases[i].perRun ? " us" : " MB/s");
+    std::cout << std::setw(10) << "RSS kB";
+    if (preload != nullptr) {
+      std::cout << std::setw(10) << "allocs";
+    }
+  }
+  std::cout << '\n';
+  for (int lab = first; lab < argc; ++lab) {
+    std::cout << std::left << std::setw(20) << labName(argv[lab]) << std::right << std::fixed;
+    for (size_t i = 0; i < caseCount; ++i) {
+      const std::string *baseline = cases[i].perRun ? &one : nullptr;
+      Result result = runCase(argv[lab], inputs[i], baseline, cases[i].repeats, preload, stats, timeout);
+      if (result.error == nullptr) {
+        if (cases[i].perRun) {
+          std::cout << std::setw(12) << std::setprecision(1) << result.seconds * 1e6;
+        } else {
+          double bytes = cases[i].length + std::strlen(cases[i].ending);
+          std::cout << std::setw(12) << std::setprecision(2) << bytes / result.seconds / 1e6;
+        }
+        std::cout << std::setw(10) << result.peakKb;
+        if (preload != nullptr) {
+          std::cout << std::setw(10) << result.allocations;
+        }
+      } else {
+        std::cout << std::setw(12) << result.error << std::setw(10) << "-";
+        if (preload != nullptr) {
+          std::cout << std::setw(10) << "-";
+        }
+      }
+    }
+    std::cout << '\n';
+  }
+  unlink(stats.c_str());
+  rmdir(dir);
+  return 0;
+}